@@ -0,0 +1,838 @@
+#ifndef BIG_INT_HPP_INCLUDED
+#define BIG_INT_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///  \file   BigInt.hpp
+///  \brief  Arbitrary precision signed integer, usable as the integer of a Fraction
+///          (Fraction<BigInt>): the 4 operations, the remainder, the shifts and the
+///          comparisons, with the semantic of the built-in integers (the division is
+///          truncated toward 0, and the remainder has the sign of the dividend).
+///          The magnitude is stored in 32 bits limbs (least significant first). The
+///          products use Karatsuba's algorithm for the large operands, the divisions
+///          Knuth's algorithm D, or a reciprocal by Newton's iteration when the divisor
+///          and the quotient are both large. The gcd of large values is computed by
+///          half-GCD (subquadratic), so the Fractions of BigInt are reduced quickly.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+///  \class BigInt
+///  \brief Arbitrary precision signed integer
+namespace dd {
+    class BigInt final {
+    public:
+        /// \fn    BigInt ();
+        /// \brief Constructor (from a built-in integer)
+        /// \param the value (default 0)
+        BigInt (std::int64_t v=0): m_negative{v < 0}, m_limbs{}
+        {
+            std::uint64_t m {(v < 0) ? (std::uint64_t{0} - static_cast<std::uint64_t>(v)) : static_cast<std::uint64_t>(v)};
+            while (m != 0) {
+                m_limbs.push_back(static_cast<std::uint32_t>(m));
+                m >>= 32;
+            } // end while
+        }
+
+        /// \fn    isNegative
+        /// \brief return true if the value is lower than 0
+        bool isNegative() const
+        {
+            return m_negative;
+        }
+
+        /// \fn    bitLength
+        /// \brief return the number of bits of the absolute value (0 for 0)
+        std::size_t bitLength() const
+        {
+            if (m_limbs.empty()) {
+                return 0;
+            } // end if
+            std::size_t n {32 * (m_limbs.size() - 1)};
+            for (std::uint32_t top {m_limbs.back()}; top != 0; top >>= 1) {
+                ++n;
+            } // end for
+            return n;
+        }
+
+        /// \fn    bool
+        /// \brief return true if the value is not 0
+        explicit operator bool () const
+        {
+            return !m_limbs.empty();
+        }
+
+        /// \fn    toInt64
+        /// \brief return the value as a built-in integer
+        /// \pre   the value shall fit in 64 bits
+        std::int64_t toInt64() const
+        {
+            std::uint64_t const m {low64(m_limbs)};
+            return m_negative ? static_cast<std::int64_t>(std::uint64_t{0} - m) : static_cast<std::int64_t>(m);
+        }
+
+        /// \fn    toString
+        /// \brief return the decimal representation
+        std::string toString() const
+        {
+            if (m_limbs.empty()) {
+                return "0";
+            } // end if
+            // chunks of 9 digits, from the least significant one
+            std::vector<std::uint32_t> chunks;
+            Limbs rest {m_limbs};
+            while (!rest.empty()) {
+                chunks.push_back(divideSmall(rest, 1000000000u));
+            } // end while
+            std::string s {m_negative ? "-" : ""};
+            s += std::to_string(chunks.back());
+            for (std::size_t i {chunks.size() - 1}; i > 0; --i) {
+                std::string const digits {std::to_string(chunks[i - 1])};
+                s += std::string(9 - digits.size(), '0') + digits;
+            } // end for
+            return s;
+        }
+
+        /// \fn    -
+        /// \brief Opposite
+        BigInt operator- () const
+        {
+            BigInt r {*this};
+            r.m_negative = !m_negative && !m_limbs.empty();
+            return r;
+        }
+
+        /// \fn    +=
+        /// \brief Self addition
+        /// \param the integer to be added
+        BigInt& operator+= (BigInt const& b)
+        {
+            addSigned(b.m_limbs, b.m_negative);
+            return (*this);
+        }
+
+        /// \fn    -=
+        /// \brief Self subtraction
+        /// \param the integer to be subtract
+        BigInt& operator-= (BigInt const& b)
+        {
+            addSigned(b.m_limbs, !b.m_negative);
+            return (*this);
+        }
+
+        /// \fn    *=
+        /// \brief Self multiplication
+        /// \param the integer to be multiplied
+        BigInt& operator*= (BigInt const& b)
+        {
+            m_limbs = multiply(m_limbs, b.m_limbs);
+            m_negative = (m_negative != b.m_negative) && !m_limbs.empty();
+            return (*this);
+        }
+
+        /// \fn    /=
+        /// \brief Self division (truncated toward 0)
+        /// \param the divisor
+        /// \pre   the divisor shall be not null
+        BigInt& operator/= (BigInt const& b)
+        {
+            BigInt q {}, r {};
+            divMod(*this, b, q, r);
+            return (*this = q);
+        }
+
+        /// \fn    %=
+        /// \brief Self remainder (with the sign of the dividend)
+        /// \param the divisor
+        /// \pre   the divisor shall be not null
+        BigInt& operator%= (BigInt const& b)
+        {
+            BigInt q {}, r {};
+            divMod(*this, b, q, r);
+            return (*this = r);
+        }
+
+        /// \fn    <<=
+        /// \brief Self shift to the left (multiplication by 2^n)
+        /// \param the number of bits
+        BigInt& operator<<= (std::size_t n)
+        {
+            if (m_limbs.empty()) {
+                return (*this);
+            } // end if
+            std::size_t const limbs {n / 32};
+            unsigned const bits {static_cast<unsigned>(n % 32)};
+            m_limbs.push_back(0);
+            if (bits != 0) {
+                for (std::size_t i {m_limbs.size() - 1}; i > 0; --i) {
+                    m_limbs[i] = static_cast<std::uint32_t>((m_limbs[i] << bits) | (m_limbs[i - 1] >> (32 - bits)));
+                } // end for
+                m_limbs[0] = static_cast<std::uint32_t>(m_limbs[0] << bits);
+            } // end if
+            m_limbs.insert(m_limbs.begin(), limbs, 0);
+            trim(m_limbs);
+            return (*this);
+        }
+
+        /// \fn    >>=
+        /// \brief Self shift to the right (division by 2^n, truncated toward 0)
+        /// \param the number of bits
+        BigInt& operator>>= (std::size_t n)
+        {
+            std::size_t const limbs {n / 32};
+            unsigned const bits {static_cast<unsigned>(n % 32)};
+            if (limbs >= m_limbs.size()) {
+                return (*this = BigInt {});
+            } // end if
+            m_limbs.erase(m_limbs.begin(), m_limbs.begin() + static_cast<std::ptrdiff_t>(limbs));
+            if (bits != 0) {
+                for (std::size_t i {0}; i + 1 < m_limbs.size(); ++i) {
+                    m_limbs[i] = static_cast<std::uint32_t>((m_limbs[i] >> bits) | (m_limbs[i + 1] << (32 - bits)));
+                } // end for
+                m_limbs.back() >>= bits;
+            } // end if
+            trim(m_limbs);
+            m_negative = m_negative && !m_limbs.empty();
+            return (*this);
+        }
+
+        /// \fn    gcd
+        /// \brief return the greatest common divisor of |a| and |b| (gcd(a, 0) = |a|):
+        ///        half-GCD for the large values (subquadratic, see halfGcd), Lehmer's
+        ///        algorithm for the medium ones, and Euclid's algorithm on 64 bits integers
+        /// \param the integers
+        static BigInt gcd(BigInt a, BigInt b)
+        {
+            a.m_negative = false;
+            b.m_negative = false;
+            if (a < b) {
+                a.m_limbs.swap(b.m_limbs);
+            } // end if
+            // each half-GCD and the next division halve the size of a
+            while (b.m_limbs.size() >= halfGcdLimbs) {
+                halfGcd(a, b, a.bitLength() / 2, nullptr);
+                if (b.m_limbs.empty()) {
+                    return a;
+                } // end if
+                euclidStep(a, b, nullptr);
+            } // end while
+            while (b.m_limbs.size() > 2) {
+                lehmerStep(a, b, nullptr);
+            } // end while
+            if (a.m_limbs.size() > 2) {
+                if (b.m_limbs.empty()) {
+                    return a;
+                } // end if
+                euclidStep(a, b, nullptr);
+            } // end if
+            std::uint64_t x {low64(a.m_limbs)}, y {low64(b.m_limbs)};
+            while (y != 0) {
+                std::uint64_t const r {x % y};
+                x = y;
+                y = r;
+            } // end while
+            BigInt g {};
+            g.m_limbs = Limbs {static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(x >> 32)};
+            trim(g.m_limbs);
+            return g;
+        }
+
+        /// \fn    divMod
+        /// \brief Quotient (truncated toward 0) and remainder (with the sign of a) of a/b
+        /// \param the dividend and the divisor (not null)
+        /// \param the quotient and the remainder
+        static void divMod(BigInt const& a, BigInt const& b, BigInt& q, BigInt& r)
+        {
+            Limbs quotient, remainder;
+            divModMagnitude(a.m_limbs, b.m_limbs, quotient, remainder);
+            q.m_limbs.swap(quotient);
+            q.m_negative = (a.m_negative != b.m_negative) && !q.m_limbs.empty();
+            r.m_limbs.swap(remainder);
+            r.m_negative = a.m_negative && !r.m_limbs.empty();
+        }
+
+        /// \fn    +, -, *, /, %, <<, >>
+        /// \brief operations (see the self operations)
+        friend BigInt operator+ (BigInt a, BigInt const& b)
+        {
+            return (a += b);
+        }
+        friend BigInt operator- (BigInt a, BigInt const& b)
+        {
+            return (a -= b);
+        }
+        friend BigInt operator* (BigInt a, BigInt const& b)
+        {
+            return (a *= b);
+        }
+        friend BigInt operator/ (BigInt a, BigInt const& b)
+        {
+            return (a /= b);
+        }
+        friend BigInt operator% (BigInt a, BigInt const& b)
+        {
+            return (a %= b);
+        }
+        friend BigInt operator<< (BigInt a, std::size_t n)
+        {
+            return (a <<= n);
+        }
+        friend BigInt operator>> (BigInt a, std::size_t n)
+        {
+            return (a >>= n);
+        }
+
+        /// \fn    ==, !=, <, >, <=, >=
+        /// \brief comparisons
+        friend bool operator== (BigInt const& a, BigInt const& b)
+        {
+            return ((a.m_negative == b.m_negative) && (a.m_limbs == b.m_limbs));
+        }
+        friend bool operator!= (BigInt const& a, BigInt const& b)
+        {
+            return !(a == b);
+        }
+        friend bool operator< (BigInt const& a, BigInt const& b)
+        {
+            if (a.m_negative != b.m_negative) {
+                return a.m_negative;
+            } // end if
+            int const c {compareMagnitude(a.m_limbs, b.m_limbs)};
+            return a.m_negative ? (c > 0) : (c < 0);
+        }
+        friend bool operator> (BigInt const& a, BigInt const& b)
+        {
+            return (b < a);
+        }
+        friend bool operator<= (BigInt const& a, BigInt const& b)
+        {
+            return !(b < a);
+        }
+        friend bool operator>= (BigInt const& a, BigInt const& b)
+        {
+            return !(a < b);
+        }
+
+        /// \fn    <<
+        /// \brief Output on flux (decimal)
+        friend std::ostream& operator<< (std::ostream& flux, BigInt const& b)
+        {
+            return (flux << b.toString());
+        }
+
+    protected:
+    private:
+        typedef std::vector<std::uint32_t> Limbs;
+
+        /// \var   karatsubaLimbs
+        /// \brief below this number of limbs, the products are computed by the schoolbook method
+        static std::size_t const karatsubaLimbs {32};
+        /// \var   newtonLimbs
+        /// \brief from this number of limbs of the divisor and of the quotient, the divisions
+        ///        are made with a reciprocal computed by Newton's iteration
+        static std::size_t const newtonLimbs {64};
+
+        /// \var   halfGcdLimbs
+        /// \brief from this number of limbs, the gcd is computed by half-GCD
+        static std::size_t const halfGcdLimbs {256};
+
+        // matrix [[a, b], [c, d]] of integers, of determinant det = +/-1: product of the
+        // steps of a gcd, (x0, y0) = M (x, y) for the initial values x0, y0 (a template, as
+        // BigInt is not yet complete here)
+        template<typename Int>
+        struct Matrix {
+            Int m_a;
+            Int m_b;
+            Int m_c;
+            Int m_d;
+            int m_det;
+        };
+        typedef Matrix<BigInt> GcdMatrix;
+
+        // (a >> shift) mod 2^64
+        static std::uint64_t bitsFrom(Limbs const& a, std::size_t shift)
+        {
+            std::size_t const first {shift / 32};
+            unsigned const offset {static_cast<unsigned>(shift % 32)};
+            std::uint64_t const w0 {(first < a.size()) ? a[first] : 0u};
+            std::uint64_t const w1 {((first + 1) < a.size()) ? a[first + 1] : 0u};
+            std::uint64_t const w2 {((first + 2) < a.size()) ? a[first + 2] : 0u};
+            if (offset == 0) {
+                return w0 | (w1 << 32);
+            } // end if
+            return (w0 >> offset) | (w1 << (32 - offset)) | (w2 << (64 - offset));
+        }
+
+        // x >= y >= 0, with the columns of m negated or swapped as x and y
+        static void normalize(BigInt& x, BigInt& y, GcdMatrix* m)
+        {
+            if (x.m_negative) {
+                x.m_negative = false;
+                if (m != nullptr) {
+                    m->m_a = -m->m_a;
+                    m->m_c = -m->m_c;
+                    m->m_det = -m->m_det;
+                } // end if
+            } // end if
+            if (y.m_negative) {
+                y.m_negative = false;
+                if (m != nullptr) {
+                    m->m_b = -m->m_b;
+                    m->m_d = -m->m_d;
+                    m->m_det = -m->m_det;
+                } // end if
+            } // end if
+            if (x < y) {
+                x.m_limbs.swap(y.m_limbs);
+                if (m != nullptr) {
+                    std::swap(m->m_a, m->m_b);
+                    std::swap(m->m_c, m->m_d);
+                    m->m_det = -m->m_det;
+                } // end if
+            } // end if
+        }
+
+        // one step of Euclid (y not null): (x, y) = (y, x mod y), m = m * [[q, 1], [1, 0]]
+        static void euclidStep(BigInt& x, BigInt& y, GcdMatrix* m)
+        {
+            BigInt q {}, r {};
+            divMod(x, y, q, r);
+            x.m_limbs.swap(y.m_limbs);
+            y.m_limbs.swap(r.m_limbs);
+            if (m != nullptr) {
+                BigInt a {(m->m_a * q) + m->m_b};
+                BigInt c {(m->m_c * q) + m->m_d};
+                m->m_b.m_limbs.swap(m->m_a.m_limbs);
+                std::swap(m->m_b.m_negative, m->m_a.m_negative);
+                m->m_d.m_limbs.swap(m->m_c.m_limbs);
+                std::swap(m->m_d.m_negative, m->m_c.m_negative);
+                m->m_a = std::move(a);
+                m->m_c = std::move(c);
+                m->m_det = -m->m_det;
+            } // end if
+        }
+
+        // one step of Lehmer (x >= y > 0): the quotients of Euclid are computed on the 62
+        // most significant bits of x and y, as long as they are the same for the smallest
+        // and the greatest values of x and y (Knuth's algorithm L), then the combination
+        // (x, y) = (A x + B y, C x + D y) is applied; one division if no quotient is sure
+        static void lehmerStep(BigInt& x, BigInt& y, GcdMatrix* m)
+        {
+            std::size_t const length {x.bitLength()};
+            std::size_t const shift {(length > 62) ? (length - 62) : 0};
+            std::int64_t xh {static_cast<std::int64_t>(bitsFrom(x.m_limbs, shift))};
+            std::int64_t yh {static_cast<std::int64_t>(bitsFrom(y.m_limbs, shift))};
+            std::int64_t a {1}, b {0}, c {0}, d {1};
+            while (((yh + c) != 0) && ((yh + d) != 0)) {
+                std::int64_t const q {(xh + a) / (yh + c)};
+                if (q != ((xh + b) / (yh + d))) {
+                    break;
+                } // end if
+                std::int64_t t {a - (q * c)};
+                a = c;
+                c = t;
+                t = b - (q * d);
+                b = d;
+                d = t;
+                t = xh - (q * yh);
+                xh = yh;
+                yh = t;
+            } // end while
+            if (b == 0) {
+                euclidStep(x, y, m);
+                return;
+            } // end if
+            BigInt const nx {(BigInt {a} * x) + (BigInt {b} * y)};
+            y = (BigInt {c} * x) + (BigInt {d} * y);
+            x = nx;
+            if (m != nullptr) {
+                // m * [[A, B], [C, D]]^-1, with [[A, B], [C, D]]^-1 = det * [[D, -B], [-C, A]]
+                int const det {(((a * d) - (b * c)) > 0) ? 1 : -1};
+                BigInt const ma {(m->m_a * d) - (m->m_b * c)};
+                BigInt const mb {(m->m_b * a) - (m->m_a * b)};
+                BigInt const mc {(m->m_c * d) - (m->m_d * c)};
+                BigInt const md {(m->m_d * a) - (m->m_c * b)};
+                m->m_a = (det > 0) ? ma : -ma;
+                m->m_b = (det > 0) ? mb : -mb;
+                m->m_c = (det > 0) ? mc : -mc;
+                m->m_d = (det > 0) ? md : -md;
+                m->m_det *= det;
+            } // end if
+            normalize(x, y, m);
+        }
+
+        // reduce x >= y >= 0 until y < 2^bits (bits: about half the size of x), with the
+        // product m of the steps (Schonhage, Moller: subquadratic). The steps are computed
+        // on the most significant halves of x and y (recursively): the quotients of the top
+        // bits are the quotients of x and y, except the last ones, so each step is a
+        // matrix of determinant +/-1 that keeps the gcd, and makes x and y shorter.
+        static void halfGcd(BigInt& x, BigInt& y, std::size_t bits, GcdMatrix* m)
+        {
+            while (y.bitLength() > bits) {
+                std::size_t const length {x.bitLength()};
+                std::size_t const before {y.bitLength()};
+                if (length <= (32 * halfGcdLimbs)) {
+                    lehmerStep(x, y, m);
+                    continue;
+                } // end if
+                // reduce the top 2r bits by r bits: x and y lose about r bits
+                std::size_t const r {((length - bits) + 1) / 2};
+                std::size_t const shift {length - (2 * r)};
+                BigInt xh {x >> shift}, yh {y >> shift};
+                GcdMatrix step {BigInt {1}, BigInt {0}, BigInt {0}, BigInt {1}, 1};
+                halfGcd(xh, yh, r, &step);
+                // (x, y) = step^-1 (x, y) = det * (d x - b y, a y - c x)
+                BigInt const nx {(step.m_d * x) - (step.m_b * y)};
+                y = (step.m_a * y) - (step.m_c * x);
+                x = nx;
+                if (step.m_det < 0) {
+                    x = -x;
+                    y = -y;
+                } // end if
+                normalize(x, y, &step);
+                if (m != nullptr) {
+                    multiplyRight(*m, step);
+                } // end if
+                if ((y.bitLength() >= before) && (y.bitLength() > bits)) {
+                    // no progress: one division
+                    euclidStep(x, y, m);
+                } // end if
+            } // end while
+        }
+
+        // m = m * r
+        static void multiplyRight(GcdMatrix& m, GcdMatrix const& r)
+        {
+            BigInt const a {(m.m_a * r.m_a) + (m.m_b * r.m_c)};
+            BigInt const b {(m.m_a * r.m_b) + (m.m_b * r.m_d)};
+            BigInt const c {(m.m_c * r.m_a) + (m.m_d * r.m_c)};
+            BigInt const d {(m.m_c * r.m_b) + (m.m_d * r.m_d)};
+            m.m_a = a;
+            m.m_b = b;
+            m.m_c = c;
+            m.m_d = d;
+            m.m_det *= r.m_det;
+        }
+
+        // value of the 2 least significant limbs
+        static std::uint64_t low64(Limbs const& a)
+        {
+            return ((a.size() > 1) ? (static_cast<std::uint64_t>(a[1]) << 32) : 0) | (a.empty() ? 0 : a[0]);
+        }
+
+        // remove the most significant null limbs
+        static void trim(Limbs& a)
+        {
+            while (!a.empty() && (a.back() == 0)) {
+                a.pop_back();
+            } // end while
+        }
+
+        static int compareMagnitude(Limbs const& a, Limbs const& b)
+        {
+            if (a.size() != b.size()) {
+                return (a.size() < b.size()) ? -1 : 1;
+            } // end if
+            for (std::size_t i {a.size()}; i > 0; --i) {
+                if (a[i - 1] != b[i - 1]) {
+                    return (a[i - 1] < b[i - 1]) ? -1 : 1;
+                } // end if
+            } // end for
+            return 0;
+        }
+
+        // a + b
+        static Limbs add(Limbs const& a, Limbs const& b)
+        {
+            Limbs const& longer {(a.size() >= b.size()) ? a : b};
+            Limbs const& shorter {(a.size() >= b.size()) ? b : a};
+            Limbs r (longer.size() + 1, 0);
+            std::uint64_t carry {0};
+            for (std::size_t i {0}; i < longer.size(); ++i) {
+                carry += static_cast<std::uint64_t>(longer[i]) + ((i < shorter.size()) ? shorter[i] : 0);
+                r[i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            } // end for
+            r.back() = static_cast<std::uint32_t>(carry);
+            trim(r);
+            return r;
+        }
+
+        // a - b, with a >= b
+        static Limbs subtract(Limbs const& a, Limbs const& b)
+        {
+            Limbs r (a.size(), 0);
+            std::int64_t borrow {0};
+            for (std::size_t i {0}; i < a.size(); ++i) {
+                std::int64_t t {static_cast<std::int64_t>(a[i]) - ((i < b.size()) ? b[i] : 0) - borrow};
+                borrow = (t < 0) ? 1 : 0;
+                r[i] = static_cast<std::uint32_t>(t + (borrow << 32));
+            } // end for
+            trim(r);
+            return r;
+        }
+
+        // r += x * 2^(32*shift)
+        static void addShifted(Limbs& r, Limbs const& x, std::size_t shift)
+        {
+            if (x.empty()) {
+                return;
+            } // end if
+            if (r.size() < shift + x.size() + 1) {
+                r.resize(shift + x.size() + 1, 0);
+            } // end if
+            std::uint64_t carry {0};
+            std::size_t i {0};
+            for (; i < x.size(); ++i) {
+                carry += static_cast<std::uint64_t>(r[shift + i]) + x[i];
+                r[shift + i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            } // end for
+            for (; carry != 0; ++i) {
+                if (shift + i == r.size()) {
+                    r.push_back(0);
+                } // end if
+                carry += r[shift + i];
+                r[shift + i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            } // end for
+            trim(r);
+        }
+
+        // this + (-1)^negative * |b|
+        void addSigned(Limbs const& b, bool negative)
+        {
+            if (m_negative == negative) {
+                m_limbs = add(m_limbs, b);
+            } else if (compareMagnitude(m_limbs, b) >= 0) {
+                m_limbs = subtract(m_limbs, b);
+            } else {
+                m_limbs = subtract(b, m_limbs);
+                m_negative = negative;
+            } // end if
+            m_negative = m_negative && !m_limbs.empty();
+        }
+
+        // limbs [begin, end[ of a
+        static Limbs slice(Limbs const& a, std::size_t begin, std::size_t end)
+        {
+            end = std::min(end, a.size());
+            if (begin >= end) {
+                return Limbs {};
+            } // end if
+            Limbs r (a.begin() + static_cast<std::ptrdiff_t>(begin), a.begin() + static_cast<std::ptrdiff_t>(end));
+            trim(r);
+            return r;
+        }
+
+        // a * b: schoolbook for the small operands, else Karatsuba
+        // (a0 + a1*B)*(b0 + b1*B) = a0*b0 + ((a0 + a1)*(b0 + b1) - a0*b0 - a1*b1)*B + a1*b1*B^2
+        static Limbs multiply(Limbs const& a, Limbs const& b)
+        {
+            if (a.size() < b.size()) {
+                return multiply(b, a);
+            } else if (b.empty()) {
+                return Limbs {};
+            } else if (b.size() < karatsubaLimbs) {
+                Limbs r (a.size() + b.size(), 0);
+                for (std::size_t j {0}; j < b.size(); ++j) {
+                    std::uint64_t const bj {b[j]};
+                    std::uint64_t carry {0};
+                    for (std::size_t i {0}; i < a.size(); ++i) {
+                        carry += (bj * a[i]) + r[i + j];
+                        r[i + j] = static_cast<std::uint32_t>(carry);
+                        carry >>= 32;
+                    } // end for
+                    r[j + a.size()] = static_cast<std::uint32_t>(carry);
+                } // end for
+                trim(r);
+                return r;
+            } // end if
+            std::size_t const half {a.size() / 2};
+            if (b.size() <= half) {
+                // unbalanced operands: only a is split
+                Limbs r {multiply(slice(a, 0, half), b)};
+                addShifted(r, multiply(slice(a, half, a.size()), b), half);
+                return r;
+            } // end if
+            Limbs const a0 {slice(a, 0, half)};
+            Limbs const a1 {slice(a, half, a.size())};
+            Limbs const b0 {slice(b, 0, half)};
+            Limbs const b1 {slice(b, half, b.size())};
+            Limbs const z0 {multiply(a0, b0)};
+            Limbs const z2 {multiply(a1, b1)};
+            Limbs const z1 {subtract(subtract(multiply(add(a0, a1), add(b0, b1)), z0), z2)};
+            Limbs r {z0};
+            addShifted(r, z1, half);
+            addShifted(r, z2, 2 * half);
+            return r;
+        }
+
+        // a = a/d, return a%d (d not null)
+        static std::uint32_t divideSmall(Limbs& a, std::uint32_t d)
+        {
+            std::uint64_t rest {0};
+            for (std::size_t i {a.size()}; i > 0; --i) {
+                std::uint64_t const current {(rest << 32) | a[i - 1]};
+                a[i - 1] = static_cast<std::uint32_t>(current / d);
+                rest = current % d;
+            } // end for
+            trim(a);
+            return static_cast<std::uint32_t>(rest);
+        }
+
+        // about 2^(L+n)/b, with L the bit length of b > 0, within a few units: Newton's
+        // iteration y + y*(1 - b*y), on the n+16 most significant bits of b, from a
+        // reciprocal of half precision (so the cost is a few products of n bits)
+        static BigInt reciprocal(BigInt const& b, std::size_t n)
+        {
+            std::size_t const length {b.bitLength()};
+            std::size_t const kept {(length < (n + 16)) ? length : (n + 16)};
+            BigInt const top {b >> (length - kept)};
+            if (n <= (newtonLimbs * 16)) {
+                // the quotient has less than newtonLimbs limbs: algorithm D
+                return (BigInt {1} << (kept + n)) / top;
+            } // end if
+            std::size_t const half {(n / 2) + 8};
+            BigInt const y {reciprocal(top, half)};
+            BigInt const error {(BigInt {1} << (kept + half)) - (top * y)};
+            return (y << (n - half)) + ((y * error) >> (kept + (2 * half) - n));
+        }
+
+        // q = u/v, r = u%v for large operands: the quotient (u * 2^(L+n)/v) / 2^(L+n) is
+        // exact within a few units, then corrected with the remainder
+        static void divModNewton(Limbs const& u, Limbs const& v, Limbs& q, Limbs& r)
+        {
+            BigInt a {}, b {};
+            a.m_limbs = u;
+            b.m_limbs = v;
+            std::size_t const length {b.bitLength()};
+            std::size_t const n {a.bitLength() - length + 2};
+            BigInt quotient {(a * reciprocal(b, n)) >> (length + n)};
+            BigInt rest {a - (quotient * b)};
+            while (rest.m_negative) {
+                quotient -= 1;
+                rest += b;
+            } // end while
+            while (rest >= b) {
+                quotient += 1;
+                rest -= b;
+            } // end while
+            q.swap(quotient.m_limbs);
+            r.swap(rest.m_limbs);
+        }
+
+        // q = u/v, r = u%v (v not null): Knuth's algorithm D, the operands being shifted
+        // so that the most significant bit of v is set
+        static void divModMagnitude(Limbs const& u, Limbs const& v, Limbs& q, Limbs& r)
+        {
+            if (compareMagnitude(u, v) < 0) {
+                q.clear();
+                r = u;
+                return;
+            } else if (v.size() == 1) {
+                q = u;
+                std::uint32_t const rest {divideSmall(q, v[0])};
+                r = (rest == 0) ? Limbs {} : Limbs {rest};
+                return;
+            } else if ((v.size() >= newtonLimbs) && ((u.size() - v.size()) >= newtonLimbs)) {
+                divModNewton(u, v, q, r);
+                return;
+            } // end if
+            std::size_t const n {v.size()};
+            std::size_t const m {u.size()};
+            unsigned s {0};
+            while ((v[n - 1] << s) < 0x80000000u) {
+                ++s;
+            } // end while
+            Limbs vn (n, 0);
+            Limbs un (m + 1, 0);
+            for (std::size_t i {n - 1}; i > 0; --i) {
+                vn[i] = static_cast<std::uint32_t>((static_cast<std::uint64_t>(v[i]) << s) | (static_cast<std::uint64_t>(v[i - 1]) >> (32 - s)));
+            } // end for
+            vn[0] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(v[0]) << s);
+            un[m] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(u[m - 1]) >> (32 - s));
+            for (std::size_t i {m - 1}; i > 0; --i) {
+                un[i] = static_cast<std::uint32_t>((static_cast<std::uint64_t>(u[i]) << s) | (static_cast<std::uint64_t>(u[i - 1]) >> (32 - s)));
+            } // end for
+            un[0] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(u[0]) << s);
+            std::uint64_t const base {std::uint64_t{1} << 32};
+            q.assign(m - n + 1, 0);
+            for (std::size_t j {m - n + 1}; j > 0; --j) {
+                std::size_t const k {j - 1};
+                // estimate of the quotient digit, corrected with the 2 next digits
+                std::uint64_t const top {(static_cast<std::uint64_t>(un[k + n]) << 32) | un[k + n - 1]};
+                std::uint64_t qhat {top / vn[n - 1]};
+                std::uint64_t rhat {top % vn[n - 1]};
+                while ((qhat >= base) || ((qhat * vn[n - 2]) > ((rhat << 32) | un[k + n - 2]))) {
+                    --qhat;
+                    rhat += vn[n - 1];
+                    if (rhat >= base) {
+                        break;
+                    } // end if
+                } // end while
+                // un[k..k+n] -= qhat * vn
+                std::int64_t borrow {0};
+                std::int64_t t {0};
+                for (std::size_t i {0}; i < n; ++i) {
+                    std::uint64_t const p {qhat * vn[i]};
+                    t = static_cast<std::int64_t>(un[i + k]) - borrow - static_cast<std::int64_t>(p & 0xFFFFFFFFu);
+                    un[i + k] = static_cast<std::uint32_t>(t);
+                    borrow = static_cast<std::int64_t>(p >> 32) - (t >> 32);
+                } // end for
+                t = static_cast<std::int64_t>(un[k + n]) - borrow;
+                un[k + n] = static_cast<std::uint32_t>(t);
+                q[k] = static_cast<std::uint32_t>(qhat);
+                if (t < 0) {
+                    // qhat was one too large: add vn back
+                    --q[k];
+                    std::uint64_t carry {0};
+                    for (std::size_t i {0}; i < n; ++i) {
+                        carry += static_cast<std::uint64_t>(un[i + k]) + vn[i];
+                        un[i + k] = static_cast<std::uint32_t>(carry);
+                        carry >>= 32;
+                    } // end for
+                    un[k + n] = static_cast<std::uint32_t>(un[k + n] + carry);
+                } // end if
+            } // end for
+            trim(q);
+            r.assign(n, 0);
+            for (std::size_t i {0}; i < n; ++i) {
+                r[i] = static_cast<std::uint32_t>((static_cast<std::uint64_t>(un[i]) >> s) | (static_cast<std::uint64_t>(un[i + 1]) << (32 - s)));
+            } // end for
+            trim(r);
+        }
+
+        /// \var   m_negative
+        /// \brief member variable: sign (false for 0)
+        bool m_negative;
+        /// \var   m_limbs
+        /// \brief member variable: magnitude, in 32 bits limbs (least significant first, no null last limb)
+        Limbs m_limbs;
+    }; // end class
+
+} //end namespace
+
+namespace std {
+    /// \class numeric_limits
+    /// \brief properties of BigInt: a signed integer, not bounded
+    template<>
+    class numeric_limits<dd::BigInt> {
+    public:
+        static constexpr bool is_specialized {true};
+        static constexpr bool is_signed {true};
+        static constexpr bool is_integer {true};
+        static constexpr bool is_exact {true};
+        static constexpr bool is_bounded {false};
+        static constexpr bool is_modulo {false};
+        static constexpr int digits {0};
+        static constexpr int radix {2};
+    };
+} //end namespace
+#endif // BIG_INT_HPP_INCLUDED
@@ -0,0 +1,429 @@
+#ifndef CONTINUED_FRACTION_HPP_INCLUDED
+#define CONTINUED_FRACTION_HPP_INCLUDED
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include "Fraction.hpp"
+
+///  \file   ContinuedFraction.hpp
+///  \brief  Lazy continued fractions: a ContinuedFraction is a stream of partial quotients
+///          [a0; a1, a2, ...], computed when they are read. It can be made of a Fraction,
+///          of the square root of an integer, or of e, and the streams can be added,
+///          subtracted, multiplied and divided with Gosper's algorithm: the result is
+///          computed term by term, reading only the terms of the operands it needs, with
+///          a state of 8 small integers (no large numerator is ever built).
+///          The convergents of a stream are the best Fractions for the terms already read.
+///          A stream is read once: the copies of a ContinuedFraction share its position.
+///          Inf and NaN give an empty stream (its only convergent is 1/0).
+///  \author Dedeun
+///  \date   16 oct 2026
+
+///  \class ContinuedFraction
+///  \brief Stream of the partial quotients of a number
+namespace dd {
+    class ContinuedFraction final {
+    public:
+        /// \fn    from_fraction
+        /// \brief return the continued fraction of a Fraction (finite)
+        /// \param the Fraction
+        template<typename T>
+        static ContinuedFraction from_fraction(Fraction<T> const& f)
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+            std::shared_ptr<Source> source {std::make_shared<Source>(Rational)};
+            source->m_coef[0] = f.num();
+            source->m_coef[1] = f.den();
+            return ContinuedFraction {source};
+        }
+
+        /// \fn    sqrt
+        /// \brief return the continued fraction of the square root of an integer
+        ///        (periodic, finite for a perfect square)
+        /// \param the integer
+        static ContinuedFraction sqrt(std::uint64_t n)
+        {
+            std::shared_ptr<Source> source {std::make_shared<Source>(SquareRoot)};
+            std::uint64_t a0 {static_cast<std::uint64_t>(std::sqrt(static_cast<double>(n)))};
+            while ((static_cast<detail::uint128>(a0) * a0) > n) {
+                --a0;
+            } // end while
+            while ((static_cast<detail::uint128>(a0 + 1) * (a0 + 1)) <= n) {
+                ++a0;
+            } // end while
+            // m, d and a of the classical algorithm: a(i+1) = floor((a0 + m)/d)
+            source->m_coef[0] = n;
+            source->m_coef[1] = a0;
+            source->m_coef[2] = 0;
+            source->m_coef[3] = 1;
+            return ContinuedFraction {source};
+        }
+
+        /// \fn    e
+        /// \brief return the continued fraction of e = [2; 1, 2, 1, 1, 4, 1, 1, 6, ...]
+        static ContinuedFraction e()
+        {
+            return ContinuedFraction {std::make_shared<Source>(Euler)};
+        }
+
+        /// \fn    bihomographic
+        /// \brief return the continued fraction of (a*x*y + b*x + c*y + d)/(e*x*y + f*x + g*y + h)
+        ///        (Gosper's algorithm: the operations on streams are made with it)
+        /// \param the streams x and y (they are read by the result)
+        /// \param the 8 coefficients
+        static ContinuedFraction bihomographic(ContinuedFraction const& x, ContinuedFraction const& y,
+                                               std::int64_t a, std::int64_t b, std::int64_t c, std::int64_t d,
+                                               std::int64_t e, std::int64_t f, std::int64_t g, std::int64_t h)
+        {
+            std::shared_ptr<Source> source {std::make_shared<Source>(Gosper)};
+            std::int64_t const coef [8] {a, b, c, d, e, f, g, h};
+            for (int i {0}; i < 8; ++i) {
+                source->m_coef[i] = coef[i];
+            } // end for
+            source->m_x = x.m_source;
+            source->m_y = y.m_source;
+            return ContinuedFraction {source};
+        }
+
+        /// \fn    next
+        /// \brief read the next partial quotient
+        /// \param the partial quotient
+        /// \return false at the end of the stream (a rational number, or a truncated stream)
+        bool next(std::int64_t& term)
+        {
+            return m_source->next(term);
+        }
+
+        /// \fn    truncated
+        /// \brief return true if the stream has been stopped before its end, because the
+        ///        state of Gosper's algorithm became too large (the terms read are right)
+        bool truncated() const
+        {
+            return m_source->m_truncated;
+        }
+
+    protected:
+    private:
+        enum Kind {Rational, SquareRoot, Euler, Gosper};
+
+        typedef detail::int128 Wide;
+
+        // floor(a/b), b not null
+        static Wide floorDiv(Wide a, Wide b)
+        {
+            Wide const q {a / b};
+            return (((a % b) != 0) && ((a < 0) != (b < 0))) ? (q - 1) : q;
+        }
+
+        static Wide absolute(Wide a)
+        {
+            return (a < 0) ? -a : a;
+        }
+
+        // state of a stream (the meaning of the coefficients depends on the kind):
+        //   Rational:   p/q
+        //   SquareRoot: n, a0, m, d
+        //   Euler:      index of the next term
+        //   Gosper:     z = (a*x*y + b*x + c*y + d)/(e*x*y + f*x + g*y + h), and the operands
+        struct Source {
+            explicit Source (Kind kind): m_kind{kind}, m_coef{0, 0, 0, 0, 0, 0, 0, 0}, m_index{0},
+                m_started{false, false}, m_ended{false, false}, m_done{false}, m_truncated{false}
+            {
+            }
+
+            bool next(std::int64_t& term)
+            {
+                if (m_done) {
+                    return false;
+                } // end if
+                switch (m_kind) {
+                case Rational:
+                    return nextRational(term);
+                case SquareRoot:
+                    return nextSquareRoot(term);
+                case Euler:
+                    term = (m_index == 0) ? 2 : ((((m_index + 1) % 3) == 0) ? (2 * ((m_index + 1) / 3)) : 1);
+                    ++m_index;
+                    return true;
+                default:
+                    return nextGosper(term);
+                } // end switch
+            }
+
+            // Euclid's algorithm (the first term is the floor of p/q)
+            bool nextRational(std::int64_t& term)
+            {
+                Wide& p {m_coef[0]};
+                Wide& q {m_coef[1]};
+                if (q == 0) {
+                    m_done = true;
+                    return false;
+                } // end if
+                Wide const t {floorDiv(p, q)};
+                Wide const r {p - (t * q)};
+                p = q;
+                q = r;
+                term = static_cast<std::int64_t>(t);
+                return true;
+            }
+
+            // m' = d*a - m, d' = (n - m'^2)/d, a' = floor((a0 + m')/d')
+            bool nextSquareRoot(std::int64_t& term)
+            {
+                Wide const n {m_coef[0]};
+                Wide const a0 {m_coef[1]};
+                Wide& m {m_coef[2]};
+                Wide& d {m_coef[3]};
+                if (m_index == 0) {
+                    ++m_index;
+                    m_done = ((a0 * a0) == n);
+                    term = static_cast<std::int64_t>(a0);
+                    return true;
+                } // end if
+                Wide const a {(a0 + m) / d};
+                m = (d * a) - m;
+                d = (n - (m * m)) / d;
+                term = static_cast<std::int64_t>((a0 + m) / d);
+                return true;
+            }
+
+            // read the next term of an operand (x: 0, y: 1), and put it in the state
+            void ingest(int operand)
+            {
+                Wide* const c {m_coef};
+                std::int64_t t {0};
+                std::shared_ptr<Source> const& source {(operand == 0) ? m_x : m_y};
+                m_started[operand] = true;
+                if (!source->next(t)) {
+                    m_truncated = m_truncated || source->m_truncated;
+                    m_ended[operand] = true;
+                } // end if
+                Wide const next [8] {
+                    (operand == 0) ? (m_ended[0] ? Wide(0) : ((c[0] * t) + c[2])) : (m_ended[1] ? Wide(0) : ((c[0] * t) + c[1])),
+                    (operand == 0) ? (m_ended[0] ? Wide(0) : ((c[1] * t) + c[3])) : c[0],
+                    (operand == 0) ? c[0] : (m_ended[1] ? Wide(0) : ((c[2] * t) + c[3])),
+                    (operand == 0) ? c[1] : c[2],
+                    (operand == 0) ? (m_ended[0] ? Wide(0) : ((c[4] * t) + c[6])) : (m_ended[1] ? Wide(0) : ((c[4] * t) + c[5])),
+                    (operand == 0) ? (m_ended[0] ? Wide(0) : ((c[5] * t) + c[7])) : c[4],
+                    (operand == 0) ? c[4] : (m_ended[1] ? Wide(0) : ((c[6] * t) + c[7])),
+                    (operand == 0) ? c[5] : c[6]};
+                for (int i {0}; i < 8; ++i) {
+                    c[i] = next[i];
+                } // end for
+            }
+
+            // numerator and denominator of z at a corner of the domain of the remainders
+            // of the operands (greater than 1): 0: x and y infinite, 1: x infinite and y = 1,
+            // 2: x = 1 and y infinite, 3: x = y = 1
+            void corner(int i, Wide& num, Wide& den) const
+            {
+                Wide const* const c {m_coef};
+                switch (i) {
+                case 0:
+                    num = c[0];
+                    den = c[4];
+                    break;
+                case 1:
+                    num = c[0] + c[1];
+                    den = c[4] + c[5];
+                    break;
+                case 2:
+                    num = c[0] + c[2];
+                    den = c[4] + c[6];
+                    break;
+                default:
+                    num = c[0] + c[1] + c[2] + c[3];
+                    den = c[4] + c[5] + c[6] + c[7];
+                    break;
+                } // end switch
+            }
+
+            // Gosper's algorithm: z is monotone in x and in y, so when its denominator has
+            // the same sign at all the corners of the domain (the operands ended are
+            // infinite), and z has the same integer part r at the corners, r is written and
+            // z becomes 1/(z - r); else a term of the operand which moves z the most is read
+            bool nextGosper(std::int64_t& term)
+            {
+                Wide* const c {m_coef};
+                Wide const limit {Wide(1) << 62};
+                while (true) {
+                    if (m_ended[0] && m_ended[1] && (c[7] == 0)) {
+                        // z = d/0: end of the stream
+                        m_done = true;
+                        return false;
+                    } else if (m_started[0] && m_started[1]) {
+                        bool const active [4] {!m_ended[0] && !m_ended[1], !m_ended[0], !m_ended[1], true};
+                        bool same {true};
+                        bool first {true};
+                        Wide r {0};
+                        int sign {0};
+                        for (int i {0}; (i < 4) && same; ++i) {
+                            if (!active[i]) {
+                                continue;
+                            } // end if
+                            Wide num {0}, den {0};
+                            corner(i, num, den);
+                            int const s {(den > 0) ? 1 : ((den < 0) ? -1 : 0)};
+                            Wide const q {(s == 0) ? Wide(0) : floorDiv(num, den)};
+                            same = (s != 0) && (first || ((s == sign) && (q == r)));
+                            sign = s;
+                            r = q;
+                            first = false;
+                        } // end for
+                        if (same) {
+                            if (absolute(r) > std::numeric_limits<std::int64_t>::max()) {
+                                return truncate();
+                            } // end if
+                            for (int i {0}; i < 4; ++i) {
+                                Wide const num {c[i]};
+                                c[i] = c[4 + i];
+                                c[4 + i] = num - (r * c[4 + i]);
+                            } // end for
+                            term = static_cast<std::int64_t>(r);
+                            return true;
+                        } // end if
+                    } // end if
+                    for (int i {0}; i < 8; ++i) {
+                        if (absolute(c[i]) > limit) {
+                            return truncate();
+                        } // end if
+                    } // end for
+                    ingest(chooseOperand());
+                } // end while
+            }
+
+            // operand to be read: the first terms first, then the one which moves z the most
+            // from its value at x = y = 1
+            int chooseOperand() const
+            {
+                if (!m_started[0] || m_ended[1]) {
+                    return 0;
+                } else if (!m_started[1] || m_ended[0]) {
+                    return 1;
+                } // end if
+                double value [4] {0, 0, 0, 0};
+                for (int i {1}; i < 4; ++i) {
+                    Wide num {0}, den {0};
+                    corner(i, num, den);
+                    value[i] = (den != 0) ? (static_cast<double>(num) / static_cast<double>(den)) : std::numeric_limits<double>::infinity();
+                } // end for
+                // (not a number: infinite)
+                double const dx {std::fabs(value[1] - value[3])};
+                double const dy {std::fabs(value[2] - value[3])};
+                return (std::isnan(dx) || (!std::isnan(dy) && (dx >= dy))) ? 0 : 1;
+            }
+
+            bool truncate()
+            {
+                m_done = true;
+                m_truncated = true;
+                return false;
+            }
+
+            Kind m_kind;
+            Wide m_coef [8];
+            std::int64_t m_index;
+            bool m_started [2];
+            bool m_ended [2];
+            bool m_done;
+            bool m_truncated;
+            std::shared_ptr<Source> m_x;
+            std::shared_ptr<Source> m_y;
+        };
+
+        explicit ContinuedFraction (std::shared_ptr<Source> const& source): m_source(source)
+        {
+        }
+
+        /// \var   m_source
+        /// \brief member variable: state of the stream (shared by the copies)
+        std::shared_ptr<Source> m_source;
+    }; // end class
+
+    /// \fn    +
+    /// \brief Addition of two streams (Gosper's algorithm)
+    /// \param the streams to be added
+    inline ContinuedFraction operator+ (ContinuedFraction const& x, ContinuedFraction const& y)
+    {
+        return ContinuedFraction::bihomographic(x, y, 0, 1, 1, 0, 0, 0, 0, 1);
+    }
+
+    /// \fn    -
+    /// \brief Subtraction of two streams (Gosper's algorithm)
+    /// \param the streams to be subtract
+    inline ContinuedFraction operator- (ContinuedFraction const& x, ContinuedFraction const& y)
+    {
+        return ContinuedFraction::bihomographic(x, y, 0, 1, -1, 0, 0, 0, 0, 1);
+    }
+
+    /// \fn    *
+    /// \brief Multiplication of two streams (Gosper's algorithm)
+    /// \param the streams to be multiplied
+    inline ContinuedFraction operator* (ContinuedFraction const& x, ContinuedFraction const& y)
+    {
+        return ContinuedFraction::bihomographic(x, y, 1, 0, 0, 0, 0, 0, 0, 1);
+    }
+
+    /// \fn    /
+    /// \brief Division of two streams (Gosper's algorithm)
+    /// \param the streams to be divided
+    inline ContinuedFraction operator/ (ContinuedFraction const& x, ContinuedFraction const& y)
+    {
+        return ContinuedFraction::bihomographic(x, y, 0, 1, 0, 0, 0, 0, 1, 0);
+    }
+
+    ///  \class Convergents
+    ///  \brief Convergents h(i)/k(i) of a stream, computed one term at a time
+    template<typename T>
+    class Convergents final {
+    public:
+        /// \fn    Convergents ();
+        /// \brief Constructor
+        /// \param the stream (read by the convergents)
+        explicit Convergents (ContinuedFraction const& cf): m_cf(cf), m_h0{0}, m_k0{1}, m_h1{1}, m_k1{0}
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+        }
+
+        /// \fn    next
+        /// \brief compute the next convergent
+        /// \param the convergent
+        /// \return false at the end of the stream, or if the convergent does not fit in T
+        bool next(Fraction<T>& f)
+        {
+            std::int64_t t {0};
+            if (!m_cf.next(t)) {
+                return false;
+            } // end if
+            detail::int128 const h2 {(static_cast<detail::int128>(t) * m_h1) + m_h0};
+            detail::int128 const k2 {(static_cast<detail::int128>(t) * m_k1) + m_k0};
+            detail::int128 const max {static_cast<detail::int128>(std::numeric_limits<T>::max())};
+            if ((h2 > max) || (h2 < -max) || (k2 > max)) {
+                return false;
+            } // end if
+            m_h0 = m_h1;
+            m_k0 = m_k1;
+            m_h1 = h2;
+            m_k1 = k2;
+            // h(i)*k(i-1) - h(i-1)*k(i) = +/-1: the convergents are reduced
+            f = Fraction<T>::from_reduced(static_cast<T>(h2), static_cast<T>(k2));
+            return true;
+        }
+
+    protected:
+    private:
+        /// \var   m_cf
+        /// \brief member variable: the stream
+        ContinuedFraction m_cf;
+        /// \var   m_h0, m_k0, m_h1, m_k1
+        /// \brief member variable: the two last convergents
+        detail::int128 m_h0;
+        detail::int128 m_k0;
+        detail::int128 m_h1;
+        detail::int128 m_k1;
+    }; // end class
+
+} //end namespace
+#endif // CONTINUED_FRACTION_HPP_INCLUDED
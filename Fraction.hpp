@@ -1,8 +1,12 @@
 #ifndef FRACTION_HPP_INCLUDED
 #define FRACTION_HPP_INCLUDED
 
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <ostream>
+#include <type_traits>
 
 
 ///  \file   Fraction.hpp
@@ -18,6 +22,43 @@
 ///         and comparison (>, >=, <, <=, ==, and !=)
 ///         (the fraction are stored in reduted forme)
 namespace dd {
+    namespace detail {
+        // 128 bits integers (GCC and Clang extension)
+        __extension__ typedef unsigned __int128 uint128;
+        __extension__ typedef __int128 int128;
+
+        // integer wide enough for the product of two T (and its unsigned type)
+        template<typename T>
+        struct WideProduct {
+            typedef typename std::conditional<(sizeof(T) <= 4), std::int64_t, int128>::type type;
+            typedef typename std::conditional<(sizeof(T) <= 4), std::uint64_t, uint128>::type unsignedType;
+        };
+
+        // absolute value, as an unsigned 64 bits integer (also for the smallest negative value)
+        template<typename T>
+        std::uint64_t magnitude(T v)
+        {
+            return (v < 0) ? (std::uint64_t{0} - static_cast<std::uint64_t>(static_cast<std::int64_t>(v)))
+                           : static_cast<std::uint64_t>(v);
+        }
+
+        // number of bits of the absolute value
+        template<typename T>
+        int bitLength(T v)
+        {
+            std::uint64_t const m {magnitude(v)};
+#if defined(__GNUC__)
+            return (m == 0) ? 0 : (64 - __builtin_clzll(m));
+#else
+            int n {0};
+            for (std::uint64_t r {m}; r != 0; r >>= 1) {
+                ++n;
+            } // end for
+            return n;
+#endif
+        }
+    } // end namespace detail
+
     template<typename T>
     class Fraction final {
     public:
@@ -27,7 +68,7 @@ namespace dd {
         /// \param Numerator
         Fraction<T> (T num=0): m_num{num}, m_den{1}
         {
-            static_assert(std::is_integral<T>::value, "Integer required.");
+            static_assert(std::numeric_limits<T>::is_integer, "Integer required.");
         }
 
         /// \fn    Fraction ();
@@ -37,7 +78,7 @@ namespace dd {
         /// \invariant Denominator shall be not null
         Fraction<T> (T num, T den): m_num{num}
         {
-            static_assert(std::is_integral<T>::value, "Integer required.");
+            static_assert(std::numeric_limits<T>::is_integer, "Integer required.");
             if (den > 0) {
                 m_den=den;
             } else {
@@ -66,47 +107,128 @@ namespace dd {
             return ((m_den == 0)&&(m_num == 0));
         }
 
+        /// \fn    num
+        /// \brief return the numerator (of the reduced Fraction)
+        T num() const
+        {
+            return m_num;
+        }
+        /// \fn    den
+        /// \brief return the denominator (of the reduced Fraction, 0 for Inf and NaN)
+        T den() const
+        {
+            return m_den;
+        }
+
+        /// \fn    from_reduced
+        /// \brief return the Fraction num/den, without any check nor reduction
+        ///        (for values already reduced: decoders, results of algorithms...)
+        /// \param Numerator and denominator
+        /// \pre   num/den shall be reduced, with a positive denominator (or 0 for Inf and NaN)
+        static Fraction<T> from_reduced(T num, T den)
+        {
+            return Fraction<T> {num, den, Reduced {}};
+        }
+
         /// \fn    +=
         /// \brief Self addition
+        ///        (fast paths: an integer operand, or the same not null denominator)
         /// \param the Fraction to be added
         Fraction<T> operator+= (Fraction<T> const& f)
         {
-            m_num = (m_num * f.m_den) + (f.m_num * m_den);
-            m_den = m_den*f.m_den;
-            reduction();
+            if (f.m_den == 1) {
+                // (n1 + n2*d1)/d1 is reduced, as n1/d1
+                m_num = m_num + (f.m_num * m_den);
+            } else if (m_den == 1) {
+                m_num = (m_num * f.m_den) + f.m_num;
+                m_den = f.m_den;
+            } else if ((m_den == f.m_den) && (m_den != 0)) {
+                m_num = m_num + f.m_num;
+                reduction();
+            } else {
+                m_num = (m_num * f.m_den) + (f.m_num * m_den);
+                m_den = m_den*f.m_den;
+                reduction();
+            } // end if
             return (*this);
         }
 
         /// \fn    -=
         /// \brief Self subtraction
+        ///        (fast paths: an integer operand, or the same not null denominator)
         /// \param the Fraction to be subtract
         Fraction<T> operator-= (Fraction<T> const& f)
         {
-            m_num = (m_num * f.m_den) - (f.m_num * m_den);
-            m_den = m_den*f.m_den;
-            reduction();
+            if (f.m_den == 1) {
+                m_num = m_num - (f.m_num * m_den);
+            } else if (m_den == 1) {
+                m_num = (m_num * f.m_den) - f.m_num;
+                m_den = f.m_den;
+            } else if ((m_den == f.m_den) && (m_den != 0)) {
+                m_num = m_num - f.m_num;
+                reduction();
+            } else {
+                m_num = (m_num * f.m_den) - (f.m_num * m_den);
+                m_den = m_den*f.m_den;
+                reduction();
+            } // end if
             return (*this);
         }
 
         /// \fn    *=
         /// \brief Self multiplication
+        ///        (fast path: a finite Fraction and an integer, reduced before the product)
         /// \param the Fraction to be multiply
         Fraction<T> operator*= (Fraction<T> const& f)
         {
-            m_num = m_num * f.m_num;
-            m_den = m_den*f.m_den;
-            reduction();
+            if ((f.m_den == 1) && (m_den != 0)) {
+                // n1*n2/d1: only n2 and d1 can have a common divisor
+                T const div {PGCD(absolute(f.m_num), m_den)};
+                m_num = m_num * (f.m_num / div);
+                m_den = m_den / div;
+            } else if ((m_den == 1) && (f.m_den != 0)) {
+                T const div {PGCD(absolute(m_num), f.m_den)};
+                m_num = (m_num / div) * f.m_num;
+                m_den = f.m_den / div;
+            } else {
+                m_num = m_num * f.m_num;
+                m_den = m_den*f.m_den;
+                reduction();
+            } // end if
             return (*this);
         }
 
         /// \fn    /=
         /// \brief Self division
+        ///        (fast paths: not null finite Fractions, with an integer operand (reduced
+        ///        before the product), or with the same denominator)
         /// \param the Fraction to be divided
         Fraction<T> operator/= (Fraction<T> const& f)
         {
-            m_num = m_num * f.m_den;
-            m_den = m_den * f.m_num;
-            reduction();
+            if ((m_num == 0) || (f.m_num == 0) || (m_den == 0) || (f.m_den == 0)) {
+                m_num = m_num * f.m_den;
+                m_den = m_den * f.m_num;
+                reduction();
+            } else if (f.m_den == 1) {
+                // n1/(d1*n2): only n1 and n2 can have a common divisor
+                T const div {PGCD(absolute(m_num), absolute(f.m_num))};
+                m_num = m_num / div;
+                m_den = m_den * (f.m_num / div);
+                setPositiveDenominator();
+            } else if (m_den == 1) {
+                T const div {PGCD(absolute(m_num), absolute(f.m_num))};
+                m_num = (m_num / div) * f.m_den;
+                m_den = f.m_num / div;
+                setPositiveDenominator();
+            } else if (m_den == f.m_den) {
+                // (n1/d)/(n2/d) is n1/n2
+                m_den = f.m_num;
+                reduction();
+            } else {
+                m_num = m_num * f.m_den;
+                m_den = m_den * f.m_num;
+                reduction();
+            } // end if
             return (*this);
         }
 
@@ -136,17 +258,120 @@ namespace dd {
 
         /// \fn    >
         /// \brief comparison: is greater than
+        ///        (when a cross product could overflow, the Fractions are compared
+        ///        with their continued fractions, without any product)
         /// \param the Fraction to be compared
         friend bool operator> (Fraction<T> const& f1, Fraction<T> const& f2)
         {
-            return ((f1.m_num * f2.m_den) > (f2.m_num * f1.m_den));
+            return greater(f1, f2, std::integral_constant<bool, std::numeric_limits<T>::is_bounded> {});
         }
 
     protected:
     private:
+        // f1 > f2, for an integer without overflow (as BigInt): cross product
+        static bool greater(Fraction<T> const& f1, Fraction<T> const& f2, std::false_type)
+        {
+            return ((f1.m_num * f2.m_den) > (f2.m_num * f1.m_den));
+        }
+
+        // f1 > f2, for a built-in integer
+        static bool greater(Fraction<T> const& f1, Fraction<T> const& f2, std::true_type)
+        {
+            int const digits {std::numeric_limits<T>::digits};
+            if (((detail::bitLength(f1.m_num) + detail::bitLength(f2.m_den)) <= digits) &&
+                ((detail::bitLength(f2.m_num) + detail::bitLength(f1.m_den)) <= digits)) {
+                return ((f1.m_num * f2.m_den) > (f2.m_num * f1.m_den));
+            } // end if
+            return continuedFractionGreater(f1, f2);
+        }
+
+        // unsigned type of the magnitudes (T itself for an integer class, as BigInt)
+        typedef typename std::conditional<std::is_integral<T>::value, std::make_unsigned<T>, std::common_type<T>>::type::type Unsigned;
+
+        // tag of the constructor without reduction
+        struct Reduced {};
+
+        Fraction<T> (T num, T den, Reduced): m_num{num}, m_den{den}
+        {
+        }
+
+        // absolute value
+        static T absolute(T v)
+        {
+            return (v < 0) ? static_cast<T>(-v) : v;
+        }
+
+        // change the numerator and denominator signs of a negative denominator
+        void setPositiveDenominator()
+        {
+            if (m_den < 0) {
+                m_num *= -1;
+                m_den *= -1;
+            } // end if
+        }
+
+        // absolute value (also for the smallest negative value)
+        static Unsigned magnitude(T v)
+        {
+            return (v < 0) ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(v)) : static_cast<Unsigned>(v);
+        }
+
+        // a/b > c/d (b and d not null): the integer parts are compared, then (if they
+        // are equal) the inverses of the fractional parts, in the reverse order
+        static bool magnitudeGreater(Unsigned a, Unsigned b, Unsigned c, Unsigned d)
+        {
+            while (true) {
+                Unsigned const qa {static_cast<Unsigned>(a / b)};
+                Unsigned const qc {static_cast<Unsigned>(c / d)};
+                if (qa != qc) {
+                    return (qa > qc);
+                } // end if
+                Unsigned const ra {static_cast<Unsigned>(a % b)};
+                Unsigned const rc {static_cast<Unsigned>(c % d)};
+                if (ra == 0) {
+                    return false;
+                } else if (rc == 0) {
+                    return true;
+                } // end if
+                // ra/b > rc/d is d/rc > b/ra
+                a = d;
+                d = ra;
+                c = b;
+                b = rc;
+            } // end while
+        }
+
+        // f1 > f2, with the same result as the cross product (without overflow)
+        static bool continuedFractionGreater(Fraction<T> const& f1, Fraction<T> const& f2)
+        {
+            if (f1.m_den == 0) {
+                // f1.m_num * f2.m_den > 0
+                return ((f2.m_den != 0) && (f1.m_num > 0));
+            } else if (f2.m_den == 0) {
+                // 0 > f2.m_num * f1.m_den
+                return (f2.m_num < 0);
+            } else if ((f1.m_num < 0) != (f2.m_num < 0)) {
+                return (f2.m_num < 0);
+            } else if (f1.m_num < 0) {
+                return magnitudeGreater(magnitude(f2.m_num), magnitude(f2.m_den), magnitude(f1.m_num), magnitude(f1.m_den));
+            } // end if
+            return magnitudeGreater(magnitude(f1.m_num), magnitude(f1.m_den), magnitude(f2.m_num), magnitude(f2.m_den));
+        }
+
         // This function compute the "greater commum divisor
-        // (algorithm find on web: http://codes-sources.commentcamarche.net/source/10495
+        // (for an integer class, as BigInt, its own gcd: half-GCD for the large values)
         T PGCD(T a, T b)
+        {
+            return PGCD(a, b, std::integral_constant<bool, std::numeric_limits<T>::is_bounded> {});
+        }
+
+        static T PGCD(T a, T b, std::false_type)
+        {
+            return T::gcd(a, b);
+        }
+
+        // (algorithm find on web: http://codes-sources.commentcamarche.net/source/10495
+        static T PGCD(T a, T b, std::true_type)
         {
             T r= a%b;
             while(r) {
@@ -264,5 +489,341 @@ namespace dd {
         return (!(f1>f2));
     }
 
+    namespace detail {
+        // n < 0 (without warning for the unsigned types)
+        template<typename I>
+        bool isNegative(I n, std::true_type)
+        {
+            return (n < 0);
+        }
+        template<typename I>
+        bool isNegative(I, std::false_type)
+        {
+            return false;
+        }
+
+        // sign of v
+        template<typename T>
+        int sign(T v)
+        {
+            return ((v > 0) ? 1 : ((v < 0) ? -1 : 0));
+        }
+
+        // sign of "num - n*den" (as for the comparison of f and Fraction(n)): sign of f-n for a
+        // finite Fraction, and sign of the numerator for Inf and NaN.
+        // There is only one product, and it is replaced by a division when it could overflow.
+        template<typename T, typename I>
+        int compareInteger(Fraction<T> const& f, I n)
+        {
+            T const num {f.num()};
+            T const den {f.den()};
+            if (den == 0) {
+                return sign(num);
+            } // end if
+            bool const negative {isNegative(n, std::is_signed<I>())};
+            bool const inRange {negative ?
+                (std::is_signed<T>::value && (static_cast<std::int64_t>(n) >= static_cast<std::int64_t>(std::numeric_limits<T>::min()))) :
+                (static_cast<std::uint64_t>(n) <= static_cast<std::uint64_t>(std::numeric_limits<T>::max()))};
+            if (!inRange) {
+                // n is out of the range of the Fraction values
+                return negative ? 1 : -1;
+            } // end if
+            T const m {static_cast<T>(n)};
+            if ((bitLength(m) + bitLength(den)) <= std::numeric_limits<T>::digits) {
+                T const p {static_cast<T>(m * den)};
+                return ((num > p) ? 1 : ((num < p) ? -1 : 0));
+            } // end if
+            // integer part (rounded toward 0) and remainder of the Fraction
+            T const q {static_cast<T>(num / den)};
+            if (q != m) {
+                return ((q > m) ? 1 : -1);
+            } // end if
+            return sign(static_cast<T>(num % den));
+        }
+
+        // sign of a/b - x, with b not null and x >= 0 (finite): the integer parts are
+        // compared, then the fractional parts (the one of x is exactly m*2^-k)
+        inline int compareMagnitude(std::uint64_t a, std::uint64_t b, double x)
+        {
+            double const xi {std::floor(x)};
+            if (xi >= 18446744073709551616.0) {
+                return -1;
+            } // end if
+            std::uint64_t const xq {static_cast<std::uint64_t>(xi)};
+            std::uint64_t const q {a / b};
+            std::uint64_t const r {a % b};
+            if (q != xq) {
+                return ((q > xq) ? 1 : -1);
+            } // end if
+            // fractional parts: r/b and xf (exact difference)
+            double const xf {x - xi};
+            if (xf == 0) {
+                return ((r > 0) ? 1 : 0);
+            } // end if
+            int exponent {0};
+            double const m {std::frexp(xf, &exponent)};
+            if (exponent < -64) {
+                // xf < 2^-65 < 1/b
+                return ((r == 0) ? -1 : 1);
+            } // end if
+            // r/b compared to m/2^k is r compared to (m*b)/2^k
+            int const k {std::numeric_limits<double>::digits - exponent};
+            uint128 const p {static_cast<uint128>(static_cast<std::uint64_t>(std::ldexp(m, std::numeric_limits<double>::digits))) * b};
+            uint128 const high {p >> k};
+            bool const low {(p & ((uint128{1} << k) - 1)) != 0};
+            if (r != high) {
+                return ((r > high) ? 1 : -1);
+            } // end if
+            return (low ? -1 : 0);
+        }
+
+        // sign of "num*b - a*den", x being the Fraction a/b (NaN is 0/0, and infinity +/-1/0):
+        // sign of f-x for finite values
+        template<typename T>
+        int compareDouble(Fraction<T> const& f, double x)
+        {
+            T const num {f.num()};
+            T const den {f.den()};
+            if (std::isnan(x)) {
+                return 0;
+            } else if (std::isinf(x)) {
+                return ((den == 0) ? 0 : ((x > 0) ? -1 : 1));
+            } else if (den == 0) {
+                return sign(num);
+            } else if ((num < 0) != (x < 0)) {
+                return ((num < 0) ? -1 : 1);
+            } else if (num < 0) {
+                return -compareMagnitude(magnitude(num), magnitude(den), -x);
+            } // end if
+            return compareMagnitude(magnitude(num), magnitude(den), x);
+        }
+
+        // f == x (for the infinite values: same sign)
+        template<typename T>
+        bool equalDouble(Fraction<T> const& f, double x)
+        {
+            if (f.isInf()) {
+                return (std::isinf(x) && ((f.num() > 0) == (x > 0)));
+            } // end if
+            return (f.isFinite() && std::isfinite(x) && (compareDouble(f, x) == 0));
+        }
+    } // end namespace detail
+
+    /// \fn    ==
+    /// \brief comparison: is equal to
+    /// \param the Fraction and the integer to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator== (Fraction<T> const& f, I n)
+    {
+        return ((f.isFinite() && (detail::compareInteger(f, n) == 0)));
+    }
+
+    /// \fn    ==
+    /// \brief comparison: is equal to
+    /// \param the integer and the Fraction to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator== (I n, Fraction<T> const& f)
+    {
+        return ((f.isFinite() && (detail::compareInteger(f, n) == 0)));
+    }
+
+    /// \fn    !=
+    /// \brief comparison: is not equal to
+    /// \param the Fraction and the integer to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator!= (Fraction<T> const& f, I n)
+    {
+        return (!(f.isFinite() && (detail::compareInteger(f, n) == 0)));
+    }
+
+    /// \fn    !=
+    /// \brief comparison: is not equal to
+    /// \param the integer and the Fraction to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator!= (I n, Fraction<T> const& f)
+    {
+        return (!(f.isFinite() && (detail::compareInteger(f, n) == 0)));
+    }
+
+    /// \fn    >
+    /// \brief comparison: is greater than
+    /// \param the Fraction and the integer to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator> (Fraction<T> const& f, I n)
+    {
+        return (detail::compareInteger(f, n) > 0);
+    }
+
+    /// \fn    >
+    /// \brief comparison: is greater than
+    /// \param the integer and the Fraction to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator> (I n, Fraction<T> const& f)
+    {
+        return (detail::compareInteger(f, n) < 0);
+    }
+
+    /// \fn    >=
+    /// \brief comparison: is greater or equal to
+    /// \param the Fraction and the integer to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator>= (Fraction<T> const& f, I n)
+    {
+        return (detail::compareInteger(f, n) >= 0);
+    }
+
+    /// \fn    >=
+    /// \brief comparison: is greater or equal to
+    /// \param the integer and the Fraction to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator>= (I n, Fraction<T> const& f)
+    {
+        return (detail::compareInteger(f, n) <= 0);
+    }
+
+    /// \fn    <
+    /// \brief comparison: is smaller than
+    /// \param the Fraction and the integer to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator< (Fraction<T> const& f, I n)
+    {
+        return (detail::compareInteger(f, n) < 0);
+    }
+
+    /// \fn    <
+    /// \brief comparison: is smaller than
+    /// \param the integer and the Fraction to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator< (I n, Fraction<T> const& f)
+    {
+        return (detail::compareInteger(f, n) > 0);
+    }
+
+    /// \fn    <=
+    /// \brief comparison: is smaller or equal to
+    /// \param the Fraction and the integer to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator<= (Fraction<T> const& f, I n)
+    {
+        return (detail::compareInteger(f, n) <= 0);
+    }
+
+    /// \fn    <=
+    /// \brief comparison: is smaller or equal to
+    /// \param the integer and the Fraction to be compared
+    template<typename T, typename I>
+    typename std::enable_if<std::is_integral<I>::value, bool>::type operator<= (I n, Fraction<T> const& f)
+    {
+        return (detail::compareInteger(f, n) >= 0);
+    }
+
+    /// \fn    ==
+    /// \brief comparison: is equal to
+    /// \param the Fraction and the double to be compared
+    template<typename T>
+    bool operator== (Fraction<T> const& f, double n)
+    {
+        return (detail::equalDouble(f, n));
+    }
+
+    /// \fn    ==
+    /// \brief comparison: is equal to
+    /// \param the double and the Fraction to be compared
+    template<typename T>
+    bool operator== (double n, Fraction<T> const& f)
+    {
+        return (detail::equalDouble(f, n));
+    }
+
+    /// \fn    !=
+    /// \brief comparison: is not equal to
+    /// \param the Fraction and the double to be compared
+    template<typename T>
+    bool operator!= (Fraction<T> const& f, double n)
+    {
+        return (!detail::equalDouble(f, n));
+    }
+
+    /// \fn    !=
+    /// \brief comparison: is not equal to
+    /// \param the double and the Fraction to be compared
+    template<typename T>
+    bool operator!= (double n, Fraction<T> const& f)
+    {
+        return (!detail::equalDouble(f, n));
+    }
+
+    /// \fn    >
+    /// \brief comparison: is greater than
+    /// \param the Fraction and the double to be compared
+    template<typename T>
+    bool operator> (Fraction<T> const& f, double n)
+    {
+        return (detail::compareDouble(f, n) > 0);
+    }
+
+    /// \fn    >
+    /// \brief comparison: is greater than
+    /// \param the double and the Fraction to be compared
+    template<typename T>
+    bool operator> (double n, Fraction<T> const& f)
+    {
+        return (detail::compareDouble(f, n) < 0);
+    }
+
+    /// \fn    >=
+    /// \brief comparison: is greater or equal to
+    /// \param the Fraction and the double to be compared
+    template<typename T>
+    bool operator>= (Fraction<T> const& f, double n)
+    {
+        return (detail::compareDouble(f, n) >= 0);
+    }
+
+    /// \fn    >=
+    /// \brief comparison: is greater or equal to
+    /// \param the double and the Fraction to be compared
+    template<typename T>
+    bool operator>= (double n, Fraction<T> const& f)
+    {
+        return (detail::compareDouble(f, n) <= 0);
+    }
+
+    /// \fn    <
+    /// \brief comparison: is smaller than
+    /// \param the Fraction and the double to be compared
+    template<typename T>
+    bool operator< (Fraction<T> const& f, double n)
+    {
+        return (detail::compareDouble(f, n) < 0);
+    }
+
+    /// \fn    <
+    /// \brief comparison: is smaller than
+    /// \param the double and the Fraction to be compared
+    template<typename T>
+    bool operator< (double n, Fraction<T> const& f)
+    {
+        return (detail::compareDouble(f, n) > 0);
+    }
+
+    /// \fn    <=
+    /// \brief comparison: is smaller or equal to
+    /// \param the Fraction and the double to be compared
+    template<typename T>
+    bool operator<= (Fraction<T> const& f, double n)
+    {
+        return (detail::compareDouble(f, n) <= 0);
+    }
+
+    /// \fn    <=
+    /// \brief comparison: is smaller or equal to
+    /// \param the double and the Fraction to be compared
+    template<typename T>
+    bool operator<= (double n, Fraction<T> const& f)
+    {
+        return (detail::compareDouble(f, n) >= 0);
+    }
+
 } //end namespace
 #endif // FRACTION_HPP_INCLUDED
@@ -0,0 +1,177 @@
+#ifndef FRACTION_COLUMN_HPP_INCLUDED
+#define FRACTION_COLUMN_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "Fraction.hpp"
+
+///  \file   FractionColumn.hpp
+///  \brief  Compressed (read only) column of Fractions.
+///          The denominators are dictionary encoded (a column usually uses only
+///          a few denominators), and the numerators are stored relatively to the
+///          smallest one (frame of reference). Both are bit packed, with the
+///          smallest width able to hold all the values of the column.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+///  \class FractionColumn
+///  \brief Compressed column of Fraction, with random access and sequential decoding
+namespace dd {
+    template<typename T>
+    class FractionColumn final {
+    public:
+        /// \fn    FractionColumn ();
+        /// \brief Constructor (empty column)
+        FractionColumn (): m_size{0}, m_base{0}, m_numWidth{0}, m_denWidth{0}
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+        }
+
+        /// \fn    FractionColumn ();
+        /// \brief Constructor (compression of an array of Fraction)
+        /// \param the Fractions to be stored, and their number
+        FractionColumn (Fraction<T> const* f, std::size_t count): m_size{count}, m_base{0}, m_numWidth{0}, m_denWidth{0}
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+            if (count == 0) {
+                return;
+            } // end if
+            // denominator dictionary and numerator range
+            T high {f[0].num()};
+            m_base = f[0].num();
+            for (std::size_t i {0}; i < count; ++i) {
+                m_dens.push_back(f[i].den());
+                m_base = std::min(m_base, f[i].num());
+                high = std::max(high, f[i].num());
+            } // end for
+            std::sort(m_dens.begin(), m_dens.end());
+            m_dens.erase(std::unique(m_dens.begin(), m_dens.end()), m_dens.end());
+            m_numWidth = bitLength(static_cast<Unsigned>(static_cast<Unsigned>(high) - static_cast<Unsigned>(m_base)));
+            m_denWidth = bitLength(static_cast<Unsigned>(m_dens.size() - 1));
+            // bit packing (with one more word, so that a read never go out of the vector)
+            m_nums.assign(((count * m_numWidth) / 64) + 2, 0);
+            m_denIndexes.assign(((count * m_denWidth) / 64) + 2, 0);
+            for (std::size_t i {0}; i < count; ++i) {
+                std::size_t const index {static_cast<std::size_t>(
+                    std::lower_bound(m_dens.begin(), m_dens.end(), f[i].den()) - m_dens.begin())};
+                put(m_nums, i * m_numWidth, m_numWidth,
+                    static_cast<Unsigned>(static_cast<Unsigned>(f[i].num()) - static_cast<Unsigned>(m_base)));
+                put(m_denIndexes, i * m_denWidth, m_denWidth, index);
+            } // end for
+        }
+
+        /// \fn    size
+        /// \brief return the number of Fractions in the column
+        std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /// \fn    memoryUsage
+        /// \brief return the number of bytes used by the compressed data
+        std::size_t memoryUsage() const
+        {
+            return ((m_nums.size() + m_denIndexes.size()) * sizeof(std::uint64_t)) + (m_dens.size() * sizeof(T));
+        }
+
+        /// \fn    []
+        /// \brief Random access
+        /// \param the index of the Fraction (shall be smaller than size())
+        Fraction<T> operator[] (std::size_t i) const
+        {
+            return make(get(m_nums, i * m_numWidth, m_numWidth),
+                        get(m_denIndexes, i * m_denWidth, m_denWidth));
+        }
+
+        /// \fn    decode
+        /// \brief Sequential decoding
+        /// \param index of the first Fraction, and number of Fractions to be decoded
+        /// \param destination of the decoded Fractions
+        void decode(std::size_t first, std::size_t count, Fraction<T>* f) const
+        {
+            std::size_t numBit {first * m_numWidth};
+            std::size_t denBit {first * m_denWidth};
+            for (std::size_t i {0}; i < count; ++i) {
+                f[i] = make(get(m_nums, numBit, m_numWidth), get(m_denIndexes, denBit, m_denWidth));
+                numBit += m_numWidth;
+                denBit += m_denWidth;
+            } // end for
+        }
+
+    protected:
+    private:
+        typedef typename std::make_unsigned<T>::type Unsigned;
+
+        // number of bits needed to write v
+        static unsigned bitLength(std::uint64_t v)
+        {
+            unsigned n {0};
+            while (v) {
+                ++n;
+                v >>= 1;
+            } // end while
+            return n;
+        }
+
+        // write the "width" bits of v at bit position "pos"
+        static void put(std::vector<std::uint64_t>& words, std::size_t pos, unsigned width, std::uint64_t v)
+        {
+            if (width == 0) {
+                return;
+            } // end if
+            std::size_t const w {pos / 64};
+            unsigned const s {static_cast<unsigned>(pos % 64)};
+            words[w] |= v << s;
+            if (s + width > 64) {
+                words[w+1] |= v >> (64 - s);
+            } // end if
+        }
+
+        // read the "width" bits at bit position "pos"
+        static std::uint64_t get(std::vector<std::uint64_t> const& words, std::size_t pos, unsigned width)
+        {
+            std::size_t const w {pos / 64};
+            unsigned const s {static_cast<unsigned>(pos % 64)};
+            std::uint64_t v {words[w] >> s};
+            if (s + width > 64) {
+                v |= words[w+1] << (64 - s);
+            } // end if
+            return (width < 64) ? (v & ((std::uint64_t{1} << width) - 1)) : v;
+        }
+
+        // build the Fraction from its packed numerator and its denominator index
+        Fraction<T> make(std::uint64_t num, std::uint64_t index) const
+        {
+            T const n {static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(num) + static_cast<Unsigned>(m_base)))};
+            // the stored Fractions were reduced
+            return Fraction<T>::from_reduced(n, m_dens[index]);
+        }
+
+        /// \var   m_size
+        /// \brief member variable: number of Fractions
+        std::size_t m_size;
+        /// \var   m_base
+        /// \brief member variable: frame of reference of the numerators (the smallest one)
+        T m_base;
+        /// \var   m_numWidth
+        /// \brief member variable: number of bits of a packed numerator
+        unsigned m_numWidth;
+        /// \var   m_denWidth
+        /// \brief member variable: number of bits of a packed denominator index
+        unsigned m_denWidth;
+        /// \var   m_dens
+        /// \brief member variable: dictionary of the denominators (sorted)
+        std::vector<T> m_dens;
+        /// \var   m_nums
+        /// \brief member variable: packed numerators (minus m_base)
+        std::vector<std::uint64_t> m_nums;
+        /// \var   m_denIndexes
+        /// \brief member variable: packed denominator indexes
+        std::vector<std::uint64_t> m_denIndexes;
+    }; // end class
+
+} //end namespace
+#endif // FRACTION_COLUMN_HPP_INCLUDED
@@ -0,0 +1,273 @@
+#ifndef FRACTION_CONVERT_HPP_INCLUDED
+#define FRACTION_CONVERT_HPP_INCLUDED
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "Fraction.hpp"
+
+///  \file   FractionConvert.hpp
+///  \brief  Conversion of Fraction to floating point values (and back).
+///          The conversions are correctly rounded (round to nearest, ties to even),
+///          NaN is converted to NaN, and Inf to +/-infinity (sign of the numerator).
+///          The conversion from floating point returns the closest Fraction with
+///          a bounded denominator.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // a/b (a and b not null) correctly rounded in the Float format:
+        // the quotient is computed (with one 128 bits division) with 2 or 3 more bits
+        // than the Float mantissa, then the remainder is folded in the last bit
+        // ("sticky" bit), so that the final conversion of this integer gives the
+        // correct rounding.
+        template<typename Float>
+        Float roundedQuotient(std::uint64_t a, std::uint64_t b)
+        {
+            int const bits {std::numeric_limits<Float>::digits + 2};
+            // 2^(bits-1) < (a*2^shift)/b < 2^(bits+1)
+            int const shift {bits - (bitLength(a) - bitLength(b))};
+            uint128 q {0};
+            uint128 r {0};
+            if (shift >= 0) {
+                uint128 const n {static_cast<uint128>(a) << shift};
+                q = n / b;
+                r = n % b;
+            } else {
+                uint128 const d {static_cast<uint128>(b) << -shift};
+                q = a / d;
+                r = a % d;
+            } // end if
+            int exponent {-shift};
+            std::uint64_t sticky {static_cast<std::uint64_t>(r != 0)};
+            if (q >= (uint128{1} << bits)) {
+                sticky |= static_cast<std::uint64_t>(q & 1);
+                q >>= 1;
+                ++exponent;
+            } // end if
+            return std::ldexp(static_cast<Float>(static_cast<std::uint64_t>(q) | sticky), exponent);
+        }
+
+        template<typename Float, typename T>
+        Float toFloating(Fraction<T> const& f)
+        {
+            T const num {f.num()};
+            T const den {f.den()};
+            int const digits {std::numeric_limits<Float>::digits};
+            if ((std::numeric_limits<T>::digits <= digits) ||
+                ((magnitude(num) <= (std::uint64_t{1} << digits)) && (magnitude(den) <= (std::uint64_t{1} << digits)))) {
+                // fast path: the numerator and denominator are exact, so the division is correctly rounded
+                // (this is also true for NaN and Inf, with a null denominator)
+                return static_cast<Float>(num) / static_cast<Float>(den);
+            } else if (den == 0) {
+                return (num > 0) ? std::numeric_limits<Float>::infinity() : -std::numeric_limits<Float>::infinity();
+            } // end if
+            Float const q {roundedQuotient<Float>(magnitude(num), magnitude(den))};
+            return (num < 0) ? -q : q;
+        }
+
+        template<typename Float, typename T>
+        void toFloating(Fraction<T> const* f, std::size_t count, Float* out)
+        {
+            int const digits {std::numeric_limits<Float>::digits};
+            std::size_t const block {8};
+            std::size_t i {0};
+            if (std::numeric_limits<T>::digits > digits) {
+                std::uint64_t const offset {std::uint64_t{1} << digits};
+                for (; i + block <= count; i += block) {
+                    // check (without branch) that the block has only exact numerators and denominators
+                    bool exact {true};
+                    for (std::size_t j {0}; j < block; ++j) {
+                        exact &= ((static_cast<std::uint64_t>(f[i+j].num()) + offset) <= (2 * offset));
+                        exact &= (static_cast<std::uint64_t>(f[i+j].den()) <= offset);
+                    } // end for
+                    if (exact) {
+                        for (std::size_t j {0}; j < block; ++j) {
+                            out[i+j] = static_cast<Float>(f[i+j].num()) / static_cast<Float>(f[i+j].den());
+                        } // end for
+                    } else {
+                        for (std::size_t j {0}; j < block; ++j) {
+                            out[i+j] = toFloating<Float>(f[i+j]);
+                        } // end for
+                    } // end if
+                } // end for
+            } else {
+                // all the values of T are exact
+                for (; i < count; ++i) {
+                    out[i] = static_cast<Float>(f[i].num()) / static_cast<Float>(f[i].den());
+                } // end for
+            } // end if
+            for (; i < count; ++i) {
+                out[i] = toFloating<Float>(f[i]);
+            } // end for
+        }
+        // closest p/q to n/d (d not null), with p <= maxNum and 0 < q <= maxDen.
+        // This is a descent in the Stern-Brocot tree, made by runs (the partial
+        // quotients of the continued fraction of n/d): p1/q1 is the last convergent,
+        // and (p0+k*p1)/(q0+k*q1) the semiconvergents of the next run. When the
+        // bound is reached, the result is one of the two last (adjacent) fractions
+        // around n/d. In case of tie, the smallest denominator is kept.
+        // (products of n/d by p and q shall fit in 127 bits)
+        inline void bestApproximation(uint128 n, uint128 d, uint128 maxNum, uint128 maxDen, uint128& p, uint128& q)
+        {
+            uint128 const x {n};
+            uint128 const y {d};
+            uint128 p0 {0}, q0 {1}, p1 {1}, q1 {0};
+            while (d != 0) {
+                uint128 const a {n / d};
+                uint128 bound {~uint128{0}};
+                if (p1 != 0) {
+                    bound = (maxNum - p0) / p1;
+                } // end if
+                if (q1 != 0) {
+                    bound = std::min(bound, (maxDen - q0) / q1);
+                } // end if
+                if (a > bound) {
+                    uint128 const p2 {p0 + (bound * p1)};
+                    uint128 const q2 {q0 + (bound * q1)};
+                    if (q1 == 0) {
+                        p = p2;
+                        q = q2;
+                        return;
+                    } else if (q2 == 0) {
+                        p = p1;
+                        q = q1;
+                        return;
+                    } // end if
+                    // p1/q1 is chosen when |x/y-p1/q1| <= |x/y-p2/q2|, and as p1*q2-p2*q1 = +/-1,
+                    // this means 2*|x*q1-y*p1|*q2 <= y (the difference is exact modulo 2^128)
+                    uint128 diff {(x * q1) - (y * p1)};
+                    if (diff >> 127) {
+                        diff = -diff;
+                    } // end if
+                    uint128 const c {y / (2 * q2)};
+                    bool const tie {(diff == c) && ((y % (2 * q2)) == 0)};
+                    if ((diff < c) || ((diff == c) && !tie) || (tie && (q1 <= q2))) {
+                        p = p1;
+                        q = q1;
+                    } else {
+                        p = p2;
+                        q = q2;
+                    } // end if
+                    return;
+                } // end if
+                uint128 const p2 {p0 + (a * p1)};
+                uint128 const q2 {q0 + (a * q1)};
+                p0 = p1;
+                q0 = q1;
+                p1 = p2;
+                q1 = q2;
+                uint128 const r {n - (a * d)};
+                n = d;
+                d = r;
+            } // end while
+            p = p1;
+            q = q1;
+        }
+    } // end namespace detail
+
+    /// \fn    to_double
+    /// \brief Conversion to double (correctly rounded)
+    /// \param the Fraction to be converted
+    template<typename T>
+    double to_double(Fraction<T> const& f)
+    {
+        return detail::toFloating<double>(f);
+    }
+
+    /// \fn    to_float
+    /// \brief Conversion to float (correctly rounded)
+    /// \param the Fraction to be converted
+    template<typename T>
+    float to_float(Fraction<T> const& f)
+    {
+        return detail::toFloating<float>(f);
+    }
+
+    /// \fn    to_double
+    /// \brief Conversion of an array of Fractions to double (correctly rounded)
+    ///        (the blocks of "exact" Fractions use a loop that the compiler can vectorize)
+    /// \param the Fractions to be converted, and their number
+    /// \param destination array
+    template<typename T>
+    void to_double(Fraction<T> const* f, std::size_t count, double* out)
+    {
+        detail::toFloating<double>(f, count, out);
+    }
+
+    /// \fn    to_float
+    /// \brief Conversion of an array of Fractions to float (correctly rounded)
+    /// \param the Fractions to be converted, and their number
+    /// \param destination array
+    template<typename T>
+    void to_float(Fraction<T> const* f, std::size_t count, float* out)
+    {
+        detail::toFloating<float>(f, count, out);
+    }
+
+    /// \fn    from_double
+    /// \brief Conversion from double: closest Fraction with a denominator not greater than maxDen
+    ///        (called as from_double<int32_t>(x, maxDen)). A value out of the range of T gives
+    ///        +/- max() of T (symmetric: never min()), NaN gives NaN and infinity gives Inf.
+    /// \param the value to be converted
+    /// \param the maximal denominator (at least 1)
+    template<typename T>
+    Fraction<T> from_double(double x, T maxDen)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        if (std::isnan(x)) {
+            return Fraction<T> {0, 0};
+        } else if (std::isinf(x)) {
+            return Fraction<T>::from_reduced(static_cast<T>((x > 0) ? 1 : -1), 0);
+        } // end if
+        T const maxNum {std::numeric_limits<T>::max()};
+        int exponent {0};
+        double const m {std::frexp(std::fabs(x), &exponent)};
+        if (exponent > std::numeric_limits<T>::digits) {
+            // |x| >= 2^digits > maxNum
+            return Fraction<T> {static_cast<T>((x > 0) ? maxNum : -maxNum)};
+        } else if ((m == 0) || (exponent < -64)) {
+            // |x| < 2^-65 <= 1/(2*maxDen), so 0 is the closest
+            return Fraction<T> {0};
+        } // end if
+        // |x| = n/d exactly, with n < 2^53 and d <= 2^117
+        int const digits {std::numeric_limits<double>::digits};
+        detail::uint128 n {static_cast<std::uint64_t>(std::ldexp(m, digits))};
+        int shift {digits - exponent};
+        while (((n & 1) == 0) && (shift > 0)) {
+            n >>= 1;
+            --shift;
+        } // end while
+        detail::uint128 d {1};
+        if (shift >= 0) {
+            d <<= shift;
+        } else {
+            n <<= -shift;
+        } // end if
+        detail::uint128 p {0}, q {1};
+        detail::bestApproximation(n, d, static_cast<std::uint64_t>(maxNum),
+                                  static_cast<std::uint64_t>(std::max(maxDen, T(1))), p, q);
+        // p/q is a convergent or a semiconvergent: it is reduced
+        T const num {static_cast<T>(p)};
+        return Fraction<T>::from_reduced(static_cast<T>((x < 0) ? -num : num), static_cast<T>(q));
+    }
+
+    /// \fn    from_double
+    /// \brief Conversion of an array of double to Fractions (see from_double)
+    /// \param the values to be converted, and their number
+    /// \param the maximal denominator (at least 1)
+    /// \param destination array
+    template<typename T>
+    void from_double(double const* x, std::size_t count, T maxDen, Fraction<T>* out)
+    {
+        for (std::size_t i {0}; i < count; ++i) {
+            out[i] = from_double<T>(x[i], maxDen);
+        } // end for
+    }
+
+} //end namespace
+#endif // FRACTION_CONVERT_HPP_INCLUDED
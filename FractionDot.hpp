@@ -0,0 +1,151 @@
+#ifndef FRACTION_DOT_HPP_INCLUDED
+#define FRACTION_DOT_HPP_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+#include "Fraction.hpp"
+#include "FractionExpr.hpp"
+
+///  \file   FractionDot.hpp
+///  \brief  Fused multiply-add and dot products of Fractions: the products and the
+///          sums are computed in integers twice as wide as T (see FractionExpr.hpp),
+///          and the result is reduced only once.
+///          DotAccumulator keeps its not reduced wide sum between the steps: it is
+///          reduced only when the next step could overflow. When the reduced sum is
+///          still too large, the sum is NaN (until reset).
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+
+    /// \fn    fma
+    /// \brief return a*b + c (one reduction)
+    /// \param the Fractions a, b and c
+    template<typename T>
+    Fraction<T> fma(Fraction<T> const& a, Fraction<T> const& b, Fraction<T> const& c)
+    {
+        return (fused(a)*b + c).value();
+    }
+
+    /// \fn    fms
+    /// \brief return a*b - c (one reduction)
+    /// \param the Fractions a, b and c
+    template<typename T>
+    Fraction<T> fms(Fraction<T> const& a, Fraction<T> const& b, Fraction<T> const& c)
+    {
+        return (fused(a)*b - c).value();
+    }
+
+    ///  \class DotAccumulator
+    ///  \brief Sum of products (acc += a*b), kept not reduced in wide integers
+    template<typename T>
+    class DotAccumulator final {
+    public:
+        /// \fn    DotAccumulator ();
+        /// \brief Constructor (the sum is 0)
+        DotAccumulator (): m_sum{0, 1}
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+        }
+
+        /// \fn    add
+        /// \brief Add the product a*b to the sum
+        /// \param the Fractions to be multiplied
+        void add(Fraction<T> const& a, Fraction<T> const& b)
+        {
+            accumulate(product(a, b));
+        }
+
+        /// \fn    sub
+        /// \brief Subtract the product a*b from the sum
+        /// \param the Fractions to be multiplied
+        void sub(Fraction<T> const& a, Fraction<T> const& b)
+        {
+            detail::WideFraction<T> p {product(a, b)};
+            p.m_num = -p.m_num;
+            accumulate(p);
+        }
+
+        /// \fn    add
+        /// \brief Add a Fraction to the sum
+        /// \param the Fraction to be added
+        void add(Fraction<T> const& a)
+        {
+            m_sum = detail::AddOp::apply(m_sum, wide(a));
+        }
+
+        /// \fn    value
+        /// \brief return the (reduced) sum
+        Fraction<T> value() const
+        {
+            return detail::toFraction(m_sum);
+        }
+
+        /// \fn    reset
+        /// \brief set the sum to 0
+        void reset()
+        {
+            m_sum = detail::WideFraction<T> {0, 1};
+        }
+
+    protected:
+    private:
+        typedef typename detail::WideFraction<T>::Wide Wide;
+
+        static detail::WideFraction<T> wide(Fraction<T> const& f)
+        {
+            return detail::WideFraction<T> {f.num(), f.den()};
+        }
+
+        // product of two T: it always fits in the wide integers
+        static detail::WideFraction<T> product(Fraction<T> const& a, Fraction<T> const& b)
+        {
+            return detail::WideFraction<T> {static_cast<Wide>(a.num()) * b.num(), static_cast<Wide>(a.den()) * b.den()};
+        }
+
+        // add p to the sum (as AddOp, written here for the inner loops): the numerators are
+        // added while the denominators are equal, else the denominators are multiplied,
+        // until the sum is too large (then it is reduced, or NaN if the lcm does not fit)
+        void accumulate(detail::WideFraction<T> const& p)
+        {
+            if ((m_sum.m_den == 0) && (m_sum.m_num == 0)) {
+                // NaN is kept
+                return;
+            } // end if
+            int const width {static_cast<int>((8 * sizeof(Wide)) - 1)};
+            int const numS {detail::numBits(m_sum)};
+            int const numP {detail::numBits(p)};
+            if ((p.m_den == m_sum.m_den) && (p.m_den != 0) && (numS < width) && (numP < width)) {
+                m_sum.m_num += p.m_num;
+                return;
+            } // end if
+            int const denS {detail::denBits(m_sum)};
+            int const denP {detail::denBits(p)};
+            if (((numS + denP) > (width - 1)) || ((numP + denS) > (width - 1)) || ((denS + denP) > width)) {
+                m_sum = detail::addReduced(m_sum, p);
+            } else {
+                m_sum.m_num = (m_sum.m_num * p.m_den) + (p.m_num * m_sum.m_den);
+                m_sum.m_den = m_sum.m_den * p.m_den;
+            } // end if
+        }
+
+        /// \var   m_sum
+        /// \brief member variable: sum (not reduced)
+        detail::WideFraction<T> m_sum;
+    }; // end class
+
+    /// \fn    dot
+    /// \brief return the dot product of two arrays of Fractions (one reduction)
+    /// \param the two arrays, and their size
+    template<typename T>
+    Fraction<T> dot(Fraction<T> const* a, Fraction<T> const* b, std::size_t count)
+    {
+        DotAccumulator<T> acc;
+        for (std::size_t i {0}; i < count; ++i) {
+            acc.add(a[i], b[i]);
+        } // end for
+        return acc.value();
+    }
+
+} //end namespace
+#endif // FRACTION_DOT_HPP_INCLUDED
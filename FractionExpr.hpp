@@ -0,0 +1,394 @@
+#ifndef FRACTION_EXPR_HPP_INCLUDED
+#define FRACTION_EXPR_HPP_INCLUDED
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "Fraction.hpp"
+
+///  \file   FractionExpr.hpp
+///  \brief  Expression templates on Fractions: an expression started by fused(),
+///          as "fused(a)*b + fused(c)*d - e", is a tree of types built at compile time.
+///          It is evaluated (when it is converted to a Fraction) in integers twice as
+///          wide as T, without intermediate reduction, and the result is reduced once.
+///          When the operands are too large for the wide products, they are reduced
+///          first, and the products are cross-cancelled; when they are still too large
+///          (or when the result does not fit in T), the value is NaN.
+///          Inf and NaN give the same results as with the operators (the numerator of
+///          Inf is reduced to 1 or -1).
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // not reduced Fraction, in integers twice as wide as T (den >= 0, except in a division)
+        template<typename T>
+        struct WideFraction {
+            typedef typename WideProduct<T>::type Wide;
+            typedef typename WideProduct<T>::unsignedType Unsigned;
+            Wide m_num;
+            Wide m_den;
+        };
+
+        // number of bits of an unsigned wide integer
+        inline int wideBitLength(std::uint64_t v)
+        {
+            return bitLength(v);
+        }
+        inline int wideBitLength(uint128 v)
+        {
+            std::uint64_t const high {static_cast<std::uint64_t>(v >> 64)};
+            return (high != 0) ? (64 + bitLength(high)) : bitLength(static_cast<std::uint64_t>(v));
+        }
+
+        // absolute value of a wide integer
+        template<typename T>
+        typename WideFraction<T>::Unsigned wideMagnitude(typename WideFraction<T>::Wide v)
+        {
+            typedef typename WideFraction<T>::Unsigned Unsigned;
+            return (v < 0) ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(v)) : static_cast<Unsigned>(v);
+        }
+
+        // greatest common divisor (gcd(a, 0) = a), in 64 bits when the values fit
+        template<typename Unsigned>
+        Unsigned wideGcd(Unsigned a, Unsigned b)
+        {
+            if (((a | b) >> 32 >> 32) == 0) {
+                std::uint64_t x {static_cast<std::uint64_t>(a)}, y {static_cast<std::uint64_t>(b)};
+                while (y != 0) {
+                    std::uint64_t const r {x % y};
+                    x = y;
+                    y = r;
+                } // end while
+                return x;
+            } // end if
+            while (b != 0) {
+                Unsigned const r {a % b};
+                a = b;
+                b = r;
+            } // end while
+            return a;
+        }
+
+        // number of bits of the numerator and of the denominator
+        template<typename T>
+        int numBits(WideFraction<T> const& f)
+        {
+            return wideBitLength(wideMagnitude<T>(f.m_num));
+        }
+        template<typename T>
+        int denBits(WideFraction<T> const& f)
+        {
+            return wideBitLength(wideMagnitude<T>(f.m_den));
+        }
+
+        // divide the numerator and the denominator by their gcd (not for Inf and NaN)
+        template<typename T>
+        void reduceWide(WideFraction<T>& f)
+        {
+            typedef typename WideFraction<T>::Wide Wide;
+            if (f.m_den != 0) {
+                Wide const div {static_cast<Wide>(wideGcd(wideMagnitude<T>(f.m_num), static_cast<typename WideFraction<T>::Unsigned>(f.m_den)))};
+                f.m_num /= div;
+                f.m_den /= div;
+            } // end if
+        }
+
+        // reduced Fraction (the numerator of Inf is reduced to 1 or -1), or NaN if it
+        // does not fit in T
+        template<typename T>
+        Fraction<T> toFraction(WideFraction<T> f)
+        {
+            typedef typename WideFraction<T>::Unsigned Unsigned;
+            if (f.m_den == 0) {
+                return Fraction<T>::from_reduced(static_cast<T>((f.m_num > 0) ? 1 : ((f.m_num < 0) ? -1 : 0)), 0);
+            } // end if
+            reduceWide(f);
+            Unsigned const max {static_cast<Unsigned>(std::numeric_limits<T>::max())};
+            if ((wideMagnitude<T>(f.m_num) > max) || (static_cast<Unsigned>(f.m_den) > max)) {
+                return Fraction<T>::from_reduced(0, 0);
+            } // end if
+            return Fraction<T>::from_reduced(static_cast<T>(f.m_num), static_cast<T>(f.m_den));
+        }
+
+        // NaN, when a result does not fit in the wide integers
+        template<typename T>
+        WideFraction<T> wideNan()
+        {
+            return WideFraction<T> {0, 0};
+        }
+
+        // numerator of Inf reduced to 1 or -1 (so it can be multiplied without overflow)
+        template<typename T>
+        void signInf(WideFraction<T>& f)
+        {
+            if (f.m_den == 0) {
+                f.m_num = (f.m_num > 0) ? 1 : ((f.m_num < 0) ? -1 : 0);
+            } // end if
+        }
+
+        // gcd used to cross-cancel a numerator and a denominator (1 for 0 and 0)
+        template<typename T>
+        typename WideFraction<T>::Wide cancelFactor(typename WideFraction<T>::Wide num, typename WideFraction<T>::Wide den)
+        {
+            typedef typename WideFraction<T>::Wide Wide;
+            Wide const div {static_cast<Wide>(wideGcd(wideMagnitude<T>(num), wideMagnitude<T>(den)))};
+            return (div == 0) ? Wide(1) : div;
+        }
+
+        // a + b, with the operands reduced first, and the lcm of the denominators
+        // a/b + c/d = (a*(d/g) + c*(b/g)) / (b*(d/g)), with g = gcd(b, d)
+        // (NaN when the products do not fit in the wide integers)
+        template<typename T>
+        WideFraction<T> addReduced(WideFraction<T> a, WideFraction<T> b)
+        {
+            typedef typename WideFraction<T>::Wide Wide;
+            int const width {static_cast<int>((8 * sizeof(Wide)) - 1)};
+            reduceWide(a);
+            reduceWide(b);
+            if ((a.m_den == 0) || (b.m_den == 0)) {
+                signInf(a);
+                signInf(b);
+                return WideFraction<T> {(a.m_num * b.m_den) + (b.m_num * a.m_den), a.m_den * b.m_den};
+            } // end if
+            Wide const g {static_cast<Wide>(wideGcd(wideMagnitude<T>(a.m_den), wideMagnitude<T>(b.m_den)))};
+            Wide const bd {b.m_den / g};
+            Wide const db {a.m_den / g};
+            int const bdBits {wideBitLength(wideMagnitude<T>(bd))};
+            // each product is lower than 2^(width-1) (so is their sum), the lcm than 2^width
+            if (((numBits(a) + bdBits) > (width - 1)) || ((numBits(b) + wideBitLength(wideMagnitude<T>(db))) > (width - 1)) ||
+                ((denBits(a) + bdBits) > width)) {
+                return wideNan<T>();
+            } // end if
+            return WideFraction<T> {(a.m_num * bd) + (b.m_num * db), a.m_den * bd};
+        }
+
+        // operations on WideFraction: the wide products are used as long as they can not
+        // overflow, else the operands are reduced (addition) or cross-cancelled (product),
+        // and the result is NaN if they are still too large
+        struct AddOp {
+            template<typename T>
+            static WideFraction<T> apply(WideFraction<T> const& a, WideFraction<T> const& b)
+            {
+                int const width {static_cast<int>((8 * sizeof(typename WideFraction<T>::Wide)) - 1)};
+                int const numA {numBits(a)};
+                int const numB {numBits(b)};
+                int const denA {denBits(a)};
+                int const denB {denBits(b)};
+                if ((a.m_den == b.m_den) && (a.m_den != 0) && (numA < width) && (numB < width)) {
+                    // same denominator (as in a sum of products of integers)
+                    return WideFraction<T> {a.m_num + b.m_num, a.m_den};
+                } else if (((numA + denB) > (width - 1)) || ((numB + denA) > (width - 1)) || ((denA + denB) > width)) {
+                    return addReduced(a, b);
+                } // end if
+                return WideFraction<T> {(a.m_num * b.m_den) + (b.m_num * a.m_den), a.m_den * b.m_den};
+            }
+        };
+
+        struct SubOp {
+            template<typename T>
+            static WideFraction<T> apply(WideFraction<T> const& a, WideFraction<T> b)
+            {
+                b.m_num = -b.m_num;
+                return AddOp::apply(a, b);
+            }
+        };
+
+        struct MulOp {
+            template<typename T>
+            static WideFraction<T> apply(WideFraction<T> a, WideFraction<T> b)
+            {
+                typedef typename WideFraction<T>::Wide Wide;
+                int const width {static_cast<int>((8 * sizeof(Wide)) - 1)};
+                if (((numBits(a) + numBits(b)) > width) || ((denBits(a) + denBits(b)) > width)) {
+                    signInf(a);
+                    signInf(b);
+                    Wide const g1 {cancelFactor<T>(a.m_num, b.m_den)};
+                    Wide const g2 {cancelFactor<T>(b.m_num, a.m_den)};
+                    a.m_num /= g1;
+                    b.m_den /= g1;
+                    b.m_num /= g2;
+                    a.m_den /= g2;
+                    if (((numBits(a) + numBits(b)) > width) || ((denBits(a) + denBits(b)) > width)) {
+                        return wideNan<T>();
+                    } // end if
+                } // end if
+                return WideFraction<T> {a.m_num * b.m_num, a.m_den * b.m_den};
+            }
+        };
+
+        struct DivOp {
+            template<typename T>
+            static WideFraction<T> apply(WideFraction<T> const& a, WideFraction<T> const& b)
+            {
+                // product by the inverse, then (as the reduction) the signs are changed
+                // when the denominator is negative
+                WideFraction<T> f {MulOp::apply(a, WideFraction<T> {b.m_den, b.m_num})};
+                if (f.m_den < 0) {
+                    f.m_num = -f.m_num;
+                    f.m_den = -f.m_den;
+                } // end if
+                return f;
+            }
+        };
+
+        // leaf of an expression: a Fraction
+        template<typename T>
+        struct LeafNode {
+            WideFraction<T> eval() const
+            {
+                return WideFraction<T> {m_value.num(), m_value.den()};
+            }
+            Fraction<T> m_value;
+        };
+
+        // node of an expression: an operation and its two operands (kept by value)
+        template<typename T, typename Op, typename Left, typename Right>
+        struct BinaryNode {
+            WideFraction<T> eval() const
+            {
+                return Op::apply(m_left.eval(), m_right.eval());
+            }
+            Left m_left;
+            Right m_right;
+        };
+    } // end namespace detail
+
+    ///  \class FractionExpr
+    ///  \brief Expression on Fractions (a tree of nodes), evaluated when it is converted
+    ///         to a Fraction
+    template<typename T, typename Node>
+    class FractionExpr final {
+    public:
+        /// \fn    FractionExpr ();
+        /// \brief Constructor
+        /// \param the root of the expression
+        explicit FractionExpr (Node const& node): m_node(node)
+        {
+        }
+
+        /// \fn    node
+        /// \brief return the root of the expression
+        Node const& node() const
+        {
+            return m_node;
+        }
+
+        /// \fn    value
+        /// \brief return the value of the expression (reduced once)
+        Fraction<T> value() const
+        {
+            return detail::toFraction(m_node.eval());
+        }
+
+        /// \fn    Fraction
+        /// \brief conversion to Fraction (value of the expression)
+        operator Fraction<T> () const
+        {
+            return value();
+        }
+
+    protected:
+    private:
+        /// \var   m_node
+        /// \brief member variable: root of the expression
+        Node m_node;
+    }; // end class
+
+    /// \fn    fused
+    /// \brief return an expression made of a Fraction (start of a fused expression)
+    /// \param the Fraction
+    template<typename T>
+    FractionExpr<T, detail::LeafNode<T>> fused(Fraction<T> const& f)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        return FractionExpr<T, detail::LeafNode<T>> {detail::LeafNode<T> {f}};
+    }
+
+    namespace detail {
+        // expression "e1 op e2"
+        template<typename Op, typename T, typename N1, typename N2>
+        FractionExpr<T, BinaryNode<T, Op, N1, N2>> makeExpr(FractionExpr<T, N1> const& e1, FractionExpr<T, N2> const& e2)
+        {
+            return FractionExpr<T, BinaryNode<T, Op, N1, N2>> {BinaryNode<T, Op, N1, N2> {e1.node(), e2.node()}};
+        }
+    } // end namespace detail
+
+    /// \fn    +
+    /// \brief Addition (expressions, or expression and Fraction)
+    /// \param the expressions to be added
+    template<typename T, typename N1, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::AddOp, N1, N2>> operator+ (FractionExpr<T, N1> const& e1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::AddOp>(e1, e2);
+    }
+    template<typename T, typename N1>
+    FractionExpr<T, detail::BinaryNode<T, detail::AddOp, N1, detail::LeafNode<T>>> operator+ (FractionExpr<T, N1> const& e1, Fraction<T> const& f2)
+    {
+        return detail::makeExpr<detail::AddOp>(e1, fused(f2));
+    }
+    template<typename T, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::AddOp, detail::LeafNode<T>, N2>> operator+ (Fraction<T> const& f1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::AddOp>(fused(f1), e2);
+    }
+
+    /// \fn    -
+    /// \brief Subtraction (expressions, or expression and Fraction)
+    /// \param the expressions to be subtract
+    template<typename T, typename N1, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::SubOp, N1, N2>> operator- (FractionExpr<T, N1> const& e1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::SubOp>(e1, e2);
+    }
+    template<typename T, typename N1>
+    FractionExpr<T, detail::BinaryNode<T, detail::SubOp, N1, detail::LeafNode<T>>> operator- (FractionExpr<T, N1> const& e1, Fraction<T> const& f2)
+    {
+        return detail::makeExpr<detail::SubOp>(e1, fused(f2));
+    }
+    template<typename T, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::SubOp, detail::LeafNode<T>, N2>> operator- (Fraction<T> const& f1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::SubOp>(fused(f1), e2);
+    }
+
+    /// \fn    *
+    /// \brief Multiplication (expressions, or expression and Fraction)
+    /// \param the expressions to be multiplied
+    template<typename T, typename N1, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::MulOp, N1, N2>> operator* (FractionExpr<T, N1> const& e1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::MulOp>(e1, e2);
+    }
+    template<typename T, typename N1>
+    FractionExpr<T, detail::BinaryNode<T, detail::MulOp, N1, detail::LeafNode<T>>> operator* (FractionExpr<T, N1> const& e1, Fraction<T> const& f2)
+    {
+        return detail::makeExpr<detail::MulOp>(e1, fused(f2));
+    }
+    template<typename T, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::MulOp, detail::LeafNode<T>, N2>> operator* (Fraction<T> const& f1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::MulOp>(fused(f1), e2);
+    }
+
+    /// \fn    /
+    /// \brief Division (expressions, or expression and Fraction)
+    /// \param the expressions to be divided
+    template<typename T, typename N1, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::DivOp, N1, N2>> operator/ (FractionExpr<T, N1> const& e1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::DivOp>(e1, e2);
+    }
+    template<typename T, typename N1>
+    FractionExpr<T, detail::BinaryNode<T, detail::DivOp, N1, detail::LeafNode<T>>> operator/ (FractionExpr<T, N1> const& e1, Fraction<T> const& f2)
+    {
+        return detail::makeExpr<detail::DivOp>(e1, fused(f2));
+    }
+    template<typename T, typename N2>
+    FractionExpr<T, detail::BinaryNode<T, detail::DivOp, detail::LeafNode<T>, N2>> operator/ (Fraction<T> const& f1, FractionExpr<T, N2> const& e2)
+    {
+        return detail::makeExpr<detail::DivOp>(fused(f1), e2);
+    }
+
+} //end namespace
+#endif // FRACTION_EXPR_HPP_INCLUDED
@@ -0,0 +1,477 @@
+#ifndef FRACTION_FACTORED_HPP_INCLUDED
+#define FRACTION_FACTORED_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "BigInt.hpp"
+#include "Fraction.hpp"
+#include "FractionProductTree.hpp"
+#include "PrimeSieve.hpp"
+
+///  \file   FractionFactored.hpp
+///  \brief  Accumulators of Fractions keeping their denominators as prime factorizations.
+///          FactoredSum keeps its denominator D as the exponents of its primes (the
+///          denominators are factorized with a PrimeSieve): the lcm of D and of the
+///          next denominator is the maximum of the exponents, and the numerator (a
+///          BigInt) is only scaled by the primes whose exponent grows, without any gcd.
+///          The sum is reduced once, at the end, by the primes of D only.
+///          FactoredProduct adds the exponents of the primes of the numerators and
+///          subtracts the ones of the denominators, so the cancellations are free and
+///          the (reduced) product is built once, at the end, with product trees.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // p^e
+        inline BigInt primePower(std::uint64_t p, unsigned e)
+        {
+            BigInt r {1};
+            BigInt base {static_cast<std::int64_t>(p)};
+            while (e != 0) {
+                if ((e & 1) != 0) {
+                    r *= base;
+                } // end if
+                e >>= 1;
+                if (e != 0) {
+                    base *= base;
+                } // end if
+            } // end while
+            return r;
+        }
+
+        // a Fraction<T> from a reduced Fraction of BigInt, or NaN if it does not fit in T
+        template<typename T>
+        Fraction<T> narrow(BigInt const& num, BigInt const& den)
+        {
+            BigInt const max {static_cast<std::int64_t>(std::numeric_limits<T>::max())};
+            if ((num > max) || (num < -max) || (den > max)) {
+                return Fraction<T>::from_reduced(0, 0);
+            } // end if
+            return Fraction<T>::from_reduced(static_cast<T>(num.toInt64()), static_cast<T>(den.toInt64()));
+        }
+    } // end namespace detail
+
+    ///  \class FactoredSum
+    ///  \brief Sum of Fractions, with a denominator kept as its prime factorization
+    ///         (the lcm of the denominators of the terms)
+    template<typename T>
+    class FactoredSum final {
+    public:
+        /// \fn    FactoredSum (PrimeSieve const& sieve);
+        /// \brief Constructor (the sum is 0)
+        /// \param the table of the primes used to factorize the denominators (it shall
+        ///        outlive the sum; it can be shared by several threads)
+        explicit FactoredSum (PrimeSieve const& sieve): m_sieve{&sieve}, m_exponents(sieve.count(), 0),
+                                                        m_used{}, m_large{}, m_num{0}, m_den{1}, m_special{0}, m_factors{}
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+        }
+
+        /// \fn    add
+        /// \brief Add a Fraction to the sum
+        /// \param the Fraction to be added
+        void add(Fraction<T> const& f)
+        {
+            if (!f.isFinite()) {
+                m_special += f;
+                return;
+            } else if (f.num() == 0) {
+                return;
+            } // end if
+            // D' = lcm(D, b) = D * raise
+            m_sieve->factorize(detail::magnitude(f.den()), m_factors);
+            BigInt raise {1};
+            for (PrimeSieve::PrimePower const& factor : m_factors) {
+                if (factor.m_index == PrimeSieve::noIndex) {
+                    addLarge(factor.m_prime, raise);
+                    continue;
+                } // end if
+                unsigned& e = exponent(factor);
+                if (factor.m_exponent > e) {
+                    raise *= detail::primePower(factor.m_prime, factor.m_exponent - e);
+                    e = factor.m_exponent;
+                } // end if
+            } // end for
+            if (raise != 1) {
+                m_num *= raise;
+                m_den *= raise;
+            } // end if
+            // N' = N*raise + a*(D'/b)
+            BigInt const den {static_cast<std::int64_t>(f.den())};
+            m_num += (m_den / den) * BigInt {static_cast<std::int64_t>(f.num())};
+        }
+
+        /// \fn    sub
+        /// \brief Subtract a Fraction from the sum
+        /// \param the Fraction to be subtracted
+        void sub(Fraction<T> const& f)
+        {
+            add(Fraction<T> {0} - f);
+        }
+
+        /// \fn    bigValue
+        /// \brief return the (reduced) sum, as a Fraction of BigInt (NaN and Inf: 0/0 and
+        ///        +/-1/0). The numerator is divided by the primes of the denominator only.
+        Fraction<BigInt> bigValue() const
+        {
+            if (!m_special.isFinite()) {
+                return Fraction<BigInt>::from_reduced(BigInt {static_cast<std::int64_t>(m_special.num())}, BigInt {0});
+            } else if (!m_num) {
+                return Fraction<BigInt> {};
+            } // end if
+            BigInt num {m_num};
+            std::vector<BigInt> powers;
+            for (std::uint32_t const index : m_used) {
+                powers.push_back(cancel(num, m_sieve->prime(index), m_exponents[index]));
+            } // end for
+            if (!m_large.empty()) {
+                // the factors greater than the table can be composite: gcd of their product
+                BigInt large {1};
+                for (PrimeSieve::PrimePower const& factor : m_large) {
+                    large *= detail::primePower(factor.m_prime, factor.m_exponent);
+                } // end for
+                BigInt const g {BigInt::gcd(num, large)};
+                num /= g;
+                powers.push_back(large / g);
+            } // end if
+            if (powers.empty()) {
+                powers.push_back(BigInt {1});
+            } // end if
+            // D = product of the remaining prime powers (balanced product tree)
+            BigInt const den {detail::buildTree(std::move(powers), detail::multiplyNodes).back()[0]};
+            return Fraction<BigInt>::from_reduced(num, den);
+        }
+
+        /// \fn    value
+        /// \brief return the (reduced) sum, or NaN if it does not fit in T
+        Fraction<T> value() const
+        {
+            if (!m_special.isFinite()) {
+                return m_special;
+            } // end if
+            Fraction<BigInt> const sum {bigValue()};
+            return detail::narrow<T>(sum.num(), sum.den());
+        }
+
+        /// \fn    reset
+        /// \brief set the sum to 0
+        void reset()
+        {
+            for (std::uint32_t const index : m_used) {
+                m_exponents[index] = 0;
+            } // end for
+            m_used.clear();
+            m_large.clear();
+            m_num = 0;
+            m_den = 1;
+            m_special = Fraction<T> {0};
+        }
+
+    protected:
+    private:
+        // factor greater than the table, with its exponents in the denominator of the sum
+        // and in the denominator of the added term
+        struct LargePart {
+            std::uint64_t m_factor;
+            unsigned m_inSum;
+            unsigned m_inTerm;
+        };
+
+        // exponent of a prime of the table in the denominator (added with the exponent 0 if needed)
+        unsigned& exponent(PrimeSieve::PrimePower const& factor)
+        {
+            if (m_exponents[factor.m_index] == 0) {
+                m_used.push_back(factor.m_index);
+            } // end if
+            return m_exponents[factor.m_index];
+        }
+
+        // lcm with a factor c greater than the table (it can be composite): c and the
+        // factors of m_large are split by their gcds (x = g * x/g), until they are coprime,
+        // so the exponents of the lcm are still the maximum of the exponents
+        void addLarge(std::uint64_t c, BigInt& raise)
+        {
+            std::vector<LargePart> parts;
+            for (PrimeSieve::PrimePower const& large : m_large) {
+                parts.push_back(LargePart {large.m_prime, large.m_exponent, 0});
+            } // end for
+            std::vector<LargePart> pending {LargePart {c, 0, 1}};
+            while (!pending.empty()) {
+                LargePart const v (pending.back());
+                pending.pop_back();
+                bool coprime {true};
+                for (std::size_t i {0}; i < parts.size(); ++i) {
+                    std::uint64_t const g {detail::gcd64(v.m_factor, parts[i].m_factor)};
+                    if (g != 1) {
+                        LargePart const w (parts[i]);
+                        parts[i] = parts.back();
+                        parts.pop_back();
+                        // v^e = g^e * (v/g)^e, and the same for w
+                        pending.push_back(LargePart {g, v.m_inSum + w.m_inSum, v.m_inTerm + w.m_inTerm});
+                        if (v.m_factor != g) {
+                            pending.push_back(LargePart {v.m_factor / g, v.m_inSum, v.m_inTerm});
+                        } // end if
+                        if (w.m_factor != g) {
+                            pending.push_back(LargePart {w.m_factor / g, w.m_inSum, w.m_inTerm});
+                        } // end if
+                        coprime = false;
+                        break;
+                    } // end if
+                } // end for
+                if (coprime) {
+                    parts.push_back(v);
+                } // end if
+            } // end while
+            m_large.clear();
+            for (LargePart const& part : parts) {
+                if (part.m_inTerm > part.m_inSum) {
+                    raise *= detail::primePower(part.m_factor, part.m_inTerm - part.m_inSum);
+                } // end if
+                unsigned const e {(part.m_inTerm > part.m_inSum) ? part.m_inTerm : part.m_inSum};
+                m_large.push_back(PrimeSieve::PrimePower {part.m_factor, PrimeSieve::noIndex, e});
+            } // end for
+        }
+
+        // divide num by p while it is possible (at most e times), return p^(e - divisions)
+        static BigInt cancel(BigInt& num, std::uint64_t p, unsigned e)
+        {
+            BigInt const prime {static_cast<std::int64_t>(p)};
+            BigInt q {}, r {};
+            while (e != 0) {
+                BigInt::divMod(num, prime, q, r);
+                if (r) {
+                    break;
+                } // end if
+                num = q;
+                --e;
+            } // end while
+            return detail::primePower(p, e);
+        }
+
+        /// \var   m_sieve
+        /// \brief member variable: table of the primes
+        PrimeSieve const* m_sieve;
+        /// \var   m_exponents
+        /// \brief member variable: exponent of each prime of the table in the denominator
+        std::vector<unsigned> m_exponents;
+        /// \var   m_used
+        /// \brief member variable: indexes of the primes of the table in the denominator
+        std::vector<std::uint32_t> m_used;
+        /// \var   m_large
+        /// \brief member variable: factors of the denominator greater than the table (coprime)
+        std::vector<PrimeSieve::PrimePower> m_large;
+        /// \var   m_num
+        /// \brief member variable: numerator of the sum (not reduced)
+        BigInt m_num;
+        /// \var   m_den
+        /// \brief member variable: denominator of the sum (product of the prime powers)
+        BigInt m_den;
+        /// \var   m_special
+        /// \brief member variable: sum of the infinite terms (0, +/-Inf or NaN)
+        Fraction<T> m_special;
+        /// \var   m_factors
+        /// \brief member variable: factors of the last denominator (kept to save allocations)
+        std::vector<PrimeSieve::PrimePower> m_factors;
+    }; // end class
+
+    ///  \class FactoredProduct
+    ///  \brief Product of Fractions, kept as the exponents of the primes of the numerators
+    ///         (added) and of the denominators (subtracted)
+    template<typename T>
+    class FactoredProduct final {
+    public:
+        /// \fn    FactoredProduct (PrimeSieve const& sieve);
+        /// \brief Constructor (the product is 1)
+        /// \param the table of the primes used to factorize the numerators and the
+        ///        denominators (it shall outlive the product; it can be shared by several threads)
+        explicit FactoredProduct (PrimeSieve const& sieve): m_sieve{&sieve}, m_exponents(sieve.count(), 0),
+                                                            m_listed(sieve.count(), false), m_used{}, m_large{}, m_negative{false}, m_zero{false},
+                                                            m_infinite{false}, m_nan{false}, m_factors{}
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+        }
+
+        /// \fn    multiply
+        /// \brief Multiply the product by a Fraction
+        /// \param the Fraction
+        void multiply(Fraction<T> const& f)
+        {
+            accumulate(f.num(), f.den());
+        }
+
+        /// \fn    divide
+        /// \brief Divide the product by a Fraction
+        /// \param the Fraction
+        void divide(Fraction<T> const& f)
+        {
+            accumulate(f.den(), f.num());
+        }
+
+        /// \fn    bigValue
+        /// \brief return the (reduced) product, as a Fraction of BigInt (NaN and Inf: 0/0
+        ///        and +/-1/0): the numerator and the denominator are the products (balanced
+        ///        product trees) of the prime powers with positive and negative exponents.
+        Fraction<BigInt> bigValue() const
+        {
+            if (m_nan || (m_zero && m_infinite)) {
+                return Fraction<BigInt>::from_reduced(BigInt {0}, BigInt {0});
+            } else if (m_infinite) {
+                return Fraction<BigInt>::from_reduced(BigInt {m_negative ? -1 : 1}, BigInt {0});
+            } else if (m_zero) {
+                return Fraction<BigInt> {};
+            } // end if
+            std::vector<BigInt> nums, dens;
+            for (std::uint32_t const index : m_used) {
+                int const e {m_exponents[index]};
+                if (e > 0) {
+                    nums.push_back(detail::primePower(m_sieve->prime(index), static_cast<unsigned>(e)));
+                } else if (e < 0) {
+                    dens.push_back(detail::primePower(m_sieve->prime(index), static_cast<unsigned>(-e)));
+                } // end if
+            } // end for
+            for (LargeFactor const& factor : m_large) {
+                if (factor.m_exponent > 0) {
+                    nums.push_back(detail::primePower(factor.m_factor, static_cast<unsigned>(factor.m_exponent)));
+                } else if (factor.m_exponent < 0) {
+                    dens.push_back(detail::primePower(factor.m_factor, static_cast<unsigned>(-factor.m_exponent)));
+                } // end if
+            } // end for
+            BigInt num {product(std::move(nums))};
+            BigInt den {product(std::move(dens))};
+            if (!m_large.empty()) {
+                // the factors greater than the table can be composite, with common factors
+                BigInt const g {BigInt::gcd(num, den)};
+                num /= g;
+                den /= g;
+            } // end if
+            return Fraction<BigInt>::from_reduced(m_negative ? -num : num, den);
+        }
+
+        /// \fn    value
+        /// \brief return the (reduced) product, or NaN if it does not fit in T
+        Fraction<T> value() const
+        {
+            Fraction<BigInt> const p {bigValue()};
+            if (!p.isFinite()) {
+                return Fraction<T>::from_reduced(static_cast<T>(p.num().toInt64()), 0);
+            } // end if
+            return detail::narrow<T>(p.num(), p.den());
+        }
+
+        /// \fn    reset
+        /// \brief set the product to 1
+        void reset()
+        {
+            for (std::uint32_t const index : m_used) {
+                m_exponents[index] = 0;
+                m_listed[index] = false;
+            } // end for
+            m_used.clear();
+            m_large.clear();
+            m_negative = false;
+            m_zero = false;
+            m_infinite = false;
+            m_nan = false;
+        }
+
+    protected:
+    private:
+        // factor greater than the table, and its exponent
+        struct LargeFactor {
+            std::uint64_t m_factor;
+            int m_exponent;
+        };
+
+        // multiply by num/den: the exponents of num are added, the ones of den subtracted
+        void accumulate(T num, T den)
+        {
+            if ((num == 0) && (den == 0)) {
+                m_nan = true;
+                return;
+            } // end if
+            m_negative = (m_negative != ((num < 0) != (den < 0)));
+            if (num == 0) {
+                m_zero = true;
+            } else if (den == 0) {
+                m_infinite = true;
+            } else {
+                addExponents(detail::magnitude(num), 1);
+                addExponents(detail::magnitude(den), -1);
+            } // end if
+        }
+
+        void addExponents(std::uint64_t n, int sign)
+        {
+            m_sieve->factorize(n, m_factors);
+            for (PrimeSieve::PrimePower const& factor : m_factors) {
+                int const e {sign * static_cast<int>(factor.m_exponent)};
+                if (factor.m_index == PrimeSieve::noIndex) {
+                    addLarge(factor.m_prime, e);
+                } else {
+                    if (!m_listed[factor.m_index]) {
+                        m_listed[factor.m_index] = true;
+                        m_used.push_back(factor.m_index);
+                    } // end if
+                    m_exponents[factor.m_index] += e;
+                } // end if
+            } // end for
+        }
+
+        void addLarge(std::uint64_t factor, int e)
+        {
+            for (LargeFactor& large : m_large) {
+                if (large.m_factor == factor) {
+                    large.m_exponent += e;
+                    return;
+                } // end if
+            } // end for
+            m_large.push_back(LargeFactor {factor, e});
+        }
+
+        // product of the values (1 if there is none)
+        static BigInt product(std::vector<BigInt> values)
+        {
+            if (values.empty()) {
+                return BigInt {1};
+            } // end if
+            return detail::buildTree(std::move(values), detail::multiplyNodes).back()[0];
+        }
+
+        /// \var   m_sieve
+        /// \brief member variable: table of the primes
+        PrimeSieve const* m_sieve;
+        /// \var   m_exponents
+        /// \brief member variable: exponent of each prime of the table (negative: in the denominator)
+        std::vector<int> m_exponents;
+        /// \var   m_listed
+        /// \brief member variable: true for the primes of the table in m_used
+        std::vector<bool> m_listed;
+        /// \var   m_used
+        /// \brief member variable: indexes of the primes of the table met in the product
+        std::vector<std::uint32_t> m_used;
+        /// \var   m_large
+        /// \brief member variable: factors greater than the table
+        std::vector<LargeFactor> m_large;
+        /// \var   m_negative
+        /// \brief member variable: sign of the product
+        bool m_negative;
+        /// \var   m_zero
+        /// \brief member variable: true if a factor is 0
+        bool m_zero;
+        /// \var   m_infinite
+        /// \brief member variable: true if a factor is infinite
+        bool m_infinite;
+        /// \var   m_nan
+        /// \brief member variable: true if a factor is NaN
+        bool m_nan;
+        /// \var   m_factors
+        /// \brief member variable: factors of the last integer (kept to save allocations)
+        std::vector<PrimeSieve::PrimePower> m_factors;
+    }; // end class
+
+} //end namespace
+#endif // FRACTION_FACTORED_HPP_INCLUDED
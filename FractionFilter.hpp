@@ -0,0 +1,155 @@
+#ifndef FRACTION_FILTER_HPP_INCLUDED
+#define FRACTION_FILTER_HPP_INCLUDED
+
+#include <cmath>
+#include "Fraction.hpp"
+
+///  \file   FractionFilter.hpp
+///  \brief  Filtered comparisons of Fractions: the Fractions are first compared
+///          with their double approximations, and only when these approximations
+///          are too close to decide, with the exact comparison of the Fractions.
+///          The approximation num/den has a relative error lower than 3 roundings
+///          (3*2^-53), so a difference greater than 2^-50 (relative) is always right.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // approximation of a finite Fraction (relative error lower than 3*2^-53)
+        template<typename T>
+        double approximation(Fraction<T> const& f)
+        {
+            return static_cast<double>(f.num()) / static_cast<double>(f.den());
+        }
+
+        // 1 if a > b, -1 if a < b, and 0 if the approximations are too close to decide
+        inline int filteredSign(double a, double b)
+        {
+            double const gap {a - b};
+            double const bound {std::ldexp(std::fabs(a) + std::fabs(b), -50)};
+            return (gap > bound) ? 1 : ((-gap > bound) ? -1 : 0);
+        }
+    } // end namespace detail
+
+    /// \fn    filtered_greater
+    /// \brief comparison: is greater than (filtered by double approximations)
+    /// \param the Fractions to be compared
+    template<typename T>
+    bool filtered_greater(Fraction<T> const& f1, Fraction<T> const& f2)
+    {
+        if (f1.isFinite() && f2.isFinite()) {
+            int const sign {detail::filteredSign(detail::approximation(f1), detail::approximation(f2))};
+            if (sign != 0) {
+                return (sign > 0);
+            } // end if
+        } // end if
+        return (f1 > f2);
+    }
+
+    /// \fn    filtered_less
+    /// \brief comparison: is smaller than (filtered by double approximations)
+    /// \param the Fractions to be compared
+    template<typename T>
+    bool filtered_less(Fraction<T> const& f1, Fraction<T> const& f2)
+    {
+        return filtered_greater(f2, f1);
+    }
+
+    ///  \class CachedFraction
+    ///  \brief Fraction with its (cached) double approximation, for repeated comparisons
+    ///         (sort, heap...): the comparisons are filtered by the cached approximations.
+    template<typename T>
+    class CachedFraction final {
+    public:
+        /// \fn    CachedFraction ();
+        /// \brief Constructor (from a Fraction)
+        /// \param the Fraction
+        CachedFraction (Fraction<T> const& f = Fraction<T> {}): m_value{f},
+            m_approx{f.isFinite() ? detail::approximation(f) : 0.0}
+        {
+        }
+
+        /// \fn    value
+        /// \brief return the Fraction
+        Fraction<T> const& value() const
+        {
+            return m_value;
+        }
+
+        /// \fn    approximation
+        /// \brief return the cached approximation (0 for NaN and Inf)
+        double approximation() const
+        {
+            return m_approx;
+        }
+
+        /// \fn    ==
+        /// \brief comparison: is equal to
+        /// \param the CachedFraction to be compared
+        friend bool operator== (CachedFraction<T> const& f1, CachedFraction<T> const& f2)
+        {
+            return (f1.m_value == f2.m_value);
+        }
+
+        /// \fn    >
+        /// \brief comparison: is greater than
+        /// \param the CachedFraction to be compared
+        friend bool operator> (CachedFraction<T> const& f1, CachedFraction<T> const& f2)
+        {
+            if (f1.m_value.isFinite() && f2.m_value.isFinite()) {
+                int const sign {detail::filteredSign(f1.m_approx, f2.m_approx)};
+                if (sign != 0) {
+                    return (sign > 0);
+                } // end if
+            } // end if
+            return (f1.m_value > f2.m_value);
+        }
+
+    protected:
+    private:
+        /// \var   m_value
+        /// \brief member variable: the Fraction
+        Fraction<T> m_value;
+        /// \var   m_approx
+        /// \brief member variable: double approximation of the Fraction
+        double m_approx;
+    }; // end class
+
+    /// \fn    !=
+    /// \brief comparison: is not equal to
+    /// \param the CachedFraction to be compared
+    template<typename T>
+    bool operator!= (CachedFraction<T> const& f1, CachedFraction<T> const& f2)
+    {
+       return (!(f1==f2));
+    }
+
+    /// \fn    >=
+    /// \brief comparison: is greater or equal to
+    /// \param the CachedFraction to be compared
+    template<typename T>
+    bool operator>= (CachedFraction<T> const& f1, CachedFraction<T> const& f2)
+    {
+        return (!(f2>f1));
+    }
+
+    /// \fn    <
+    /// \brief comparison: is smaller than
+    /// \param the CachedFraction to be compared
+    template<typename T>
+    bool operator< (CachedFraction<T> const& f1, CachedFraction<T> const& f2)
+    {
+        return (f2>f1);
+    }
+
+    /// \fn    <=
+    /// \brief comparison: is smaller or equal to
+    /// \param the CachedFraction to be compared
+    template<typename T>
+    bool operator<= (CachedFraction<T> const& f1, CachedFraction<T> const& f2)
+    {
+        return (!(f1>f2));
+    }
+
+} //end namespace
+#endif // FRACTION_FILTER_HPP_INCLUDED
@@ -0,0 +1,180 @@
+#ifndef FRACTION_HASH_HPP_INCLUDED
+#define FRACTION_HASH_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "Fraction.hpp"
+
+///  \file   FractionHash.hpp
+///  \brief  Hash of Fractions (std::hash specialization), and interning pool.
+///          The Fractions are reduced, so equal values have the same members: the
+///          hash mixes the numerator and the denominator (multiplications and
+///          xor-shifts, as the finalizer of MurmurHash3).
+///          The pool gives a 32 bits id to each distinct Fraction. It is split in
+///          shards (chosen by the hash), each with its own mutex and hash table, so
+///          several threads can intern values at once.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // hash of a Fraction: all the bits of the result depend on all the bits of num and den
+        template<typename T>
+        std::uint64_t hashFraction(Fraction<T> const& f)
+        {
+            std::uint64_t h {static_cast<std::uint64_t>(f.num()) * 0x9E3779B97F4A7C15ull};
+            h ^= static_cast<std::uint64_t>(f.den()) + (h >> 29);
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+            h *= 0xC4CEB9FE1A85EC53ull;
+            h ^= h >> 33;
+            return h;
+        }
+    } // end namespace detail
+
+    ///  \class FractionPool
+    ///  \brief Interning pool: maps each distinct Fraction to a 32 bits id (the ids of a
+    ///         shard are the shard number in the low bits, and the rank of the Fraction
+    ///         in the shard in the high bits). Thread safe.
+    template<typename T>
+    class FractionPool final {
+    public:
+        /// \var   invalidId
+        /// \brief id returned when the pool is full
+        static std::uint32_t const invalidId {0xFFFFFFFF};
+
+        /// \fn    FractionPool ();
+        /// \brief Constructor
+        FractionPool (): m_shards(shardCount)
+        {
+        }
+
+        /// \fn    intern
+        /// \brief return the id of a Fraction (added to the pool if it is not yet there)
+        /// \param the Fraction
+        std::uint32_t intern(Fraction<T> const& f)
+        {
+            std::uint64_t const h {detail::hashFraction(f)};
+            std::uint32_t const s {static_cast<std::uint32_t>(h >> (64 - shardBits))};
+            Shard& shard {m_shards[s]};
+            std::lock_guard<std::mutex> lock {shard.m_mutex};
+            std::size_t slot {0};
+            if (shard.find(f, h, slot)) {
+                return ((shard.m_slots[slot] - 1) << shardBits) | s;
+            } // end if
+            std::size_t const rank {shard.m_values.size()};
+            if (rank >= (std::size_t{1} << (32 - shardBits)) - 1) {
+                return invalidId;
+            } // end if
+            shard.m_values.push_back(f);
+            shard.m_slots[slot] = static_cast<std::uint32_t>(rank + 1);
+            if (2 * shard.m_values.size() > shard.m_slots.size()) {
+                shard.grow();
+            } // end if
+            return static_cast<std::uint32_t>(rank << shardBits) | s;
+        }
+
+        /// \fn    find
+        /// \brief return the id of a Fraction, or invalidId if it is not in the pool
+        /// \param the Fraction
+        std::uint32_t find(Fraction<T> const& f) const
+        {
+            std::uint64_t const h {detail::hashFraction(f)};
+            std::uint32_t const s {static_cast<std::uint32_t>(h >> (64 - shardBits))};
+            Shard const& shard {m_shards[s]};
+            std::lock_guard<std::mutex> lock {shard.m_mutex};
+            std::size_t slot {0};
+            return shard.find(f, h, slot) ? (((shard.m_slots[slot] - 1) << shardBits) | s) : invalidId;
+        }
+
+        /// \fn    value
+        /// \brief return the Fraction of an id
+        /// \param the id (returned by intern)
+        Fraction<T> value(std::uint32_t id) const
+        {
+            Shard const& shard {m_shards[id & (shardCount - 1)]};
+            std::lock_guard<std::mutex> lock {shard.m_mutex};
+            return shard.m_values[id >> shardBits];
+        }
+
+        /// \fn    size
+        /// \brief return the number of distinct Fractions of the pool
+        std::size_t size() const
+        {
+            std::size_t n {0};
+            for (Shard const& shard : m_shards) {
+                std::lock_guard<std::mutex> lock {shard.m_mutex};
+                n += shard.m_values.size();
+            } // end for
+            return n;
+        }
+
+    protected:
+    private:
+        static unsigned const shardBits {4};
+        static std::size_t const shardCount {std::size_t{1} << shardBits};
+
+        // part of the pool: the Fractions, and an open addressing table (linear probing)
+        // of their ranks + 1 (0: empty slot), at most half full
+        struct Shard {
+            Shard (): m_slots(16, 0)
+            {
+            }
+
+            // slot of f (true), or the empty slot where it shall be added (false)
+            bool find(Fraction<T> const& f, std::uint64_t h, std::size_t& slot) const
+            {
+                std::size_t const mask {m_slots.size() - 1};
+                slot = static_cast<std::size_t>(h) & mask;
+                while (m_slots[slot] != 0) {
+                    if (m_values[m_slots[slot] - 1] == f) {
+                        return true;
+                    } // end if
+                    slot = (slot + 1) & mask;
+                } // end while
+                return false;
+            }
+
+            // double the size of the table
+            void grow()
+            {
+                std::vector<std::uint32_t> slots (2 * m_slots.size(), 0);
+                std::size_t const mask {slots.size() - 1};
+                for (std::size_t rank {0}; rank < m_values.size(); ++rank) {
+                    std::size_t slot {static_cast<std::size_t>(detail::hashFraction(m_values[rank])) & mask};
+                    while (slots[slot] != 0) {
+                        slot = (slot + 1) & mask;
+                    } // end while
+                    slots[slot] = static_cast<std::uint32_t>(rank + 1);
+                } // end for
+                m_slots.swap(slots);
+            }
+
+            mutable std::mutex m_mutex;
+            std::vector<Fraction<T>> m_values;
+            std::vector<std::uint32_t> m_slots;
+        };
+
+        /// \var   m_shards
+        /// \brief member variable: shards of the pool
+        std::vector<Shard> m_shards;
+    }; // end class
+
+} //end namespace
+
+namespace std {
+    /// \struct hash
+    /// \brief  hash of a Fraction (for the unordered containers)
+    template<typename T>
+    struct hash<dd::Fraction<T>> {
+        std::size_t operator() (dd::Fraction<T> const& f) const
+        {
+            return static_cast<std::size_t>(dd::detail::hashFraction(f));
+        }
+    };
+} //end namespace
+#endif // FRACTION_HASH_HPP_INCLUDED
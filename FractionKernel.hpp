@@ -0,0 +1,266 @@
+#ifndef FRACTION_KERNEL_HPP_INCLUDED
+#define FRACTION_KERNEL_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "Fraction.hpp"
+
+///  \file   FractionKernel.hpp
+///  \brief  Batch kernels on arrays of Fractions: comparisons into bitmasks, and
+///          min, max, argmin, argmax and minmax reductions.
+///          The comparisons are the cross products num1*den2 and num2*den1 computed
+///          in a wider integer (64 bits for T up to 32 bits, 128 bits for 64 bits),
+///          so they have no overflow and no branch: they give the result of operator>,
+///          and the loops can be vectorized by the compiler.
+///          NaN (isNan()) is never selected by a mask, and is skipped by the reductions
+///          (where -Inf is the smallest value and +Inf the greatest one).
+///          Masks: bit i%64 of the word i/64 is the result for the element i, the
+///          unused bits of the last word are 0.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // f1 > f2 (cross product, without overflow)
+        template<typename T>
+        bool wideGreater(Fraction<T> const& f1, Fraction<T> const& f2)
+        {
+            typedef typename WideProduct<T>::type Wide;
+            return ((static_cast<Wide>(f1.num()) * f2.den()) > (static_cast<Wide>(f2.num()) * f1.den()));
+        }
+
+        // f1 > f2 in a total order of the values which are not NaN: as wideGreater,
+        // and -Inf is smaller than +Inf
+        template<typename T>
+        bool orderedGreater(Fraction<T> const& f1, Fraction<T> const& f2)
+        {
+            return (wideGreater(f1, f2) | (((f1.den() | f2.den()) == 0) & (f1.num() > f2.num())));
+        }
+
+        // f1 == f2, false for NaN
+        template<typename T>
+        bool wideEqual(Fraction<T> const& f1, Fraction<T> const& f2)
+        {
+            return ((f1.num() == f2.num()) & (f1.den() == f2.den()) & ((f1.num() | f1.den()) != 0));
+        }
+
+        // mask of test(i) for i in [0, count[
+        template<typename Test>
+        void buildMask(std::size_t count, std::uint64_t* mask, Test test)
+        {
+            for (std::size_t w {0}; (w * 64) < count; ++w) {
+                std::size_t const begin {w * 64};
+                std::size_t const size {((count - begin) < 64) ? (count - begin) : 64};
+                std::uint64_t word {0};
+                for (std::size_t j {0}; j < size; ++j) {
+                    word |= static_cast<std::uint64_t>(test(begin + j)) << j;
+                } // end for
+                mask[w] = word;
+            } // end for
+        }
+
+        // lanes of a reduction: the first smallest (or greatest) value of each lane,
+        // with its index (count while the lane has only NaN)
+        template<typename T, bool Greater>
+        struct ExtremumLanes {
+            static std::size_t const lanes {8};
+
+            ExtremumLanes (std::size_t count)
+            {
+                for (std::size_t l {0}; l < lanes; ++l) {
+                    m_value[l] = Fraction<T> {0, 0};
+                    m_index[l] = count;
+                } // end for
+            }
+
+            // f is better than the value v of index i (on a tie, the first index)
+            static bool better(Fraction<T> const& f, std::size_t j, Fraction<T> const& v, std::size_t i, std::size_t count)
+            {
+                if (f.isNan()) {
+                    return false;
+                } else if (i == count) {
+                    return true;
+                } // end if
+                bool const strict {Greater ? orderedGreater(f, v) : orderedGreater(v, f)};
+                bool const tie {!(Greater ? orderedGreater(v, f) : orderedGreater(f, v))};
+                return (strict || (tie && (j < i)));
+            }
+
+            void update(Fraction<T> const* f, std::size_t begin, std::size_t count)
+            {
+                for (std::size_t l {0}; l < lanes; ++l) {
+                    bool const take {!f[begin + l].isNan() && ((m_index[l] == count) ||
+                        (Greater ? orderedGreater(f[begin + l], m_value[l]) : orderedGreater(m_value[l], f[begin + l])))};
+                    m_value[l] = take ? f[begin + l] : m_value[l];
+                    m_index[l] = take ? (begin + l) : m_index[l];
+                } // end for
+            }
+
+            // index of the best value of the lanes and of the tail [begin, count[
+            std::size_t result(Fraction<T> const* f, std::size_t begin, std::size_t count) const
+            {
+                std::size_t best {count};
+                Fraction<T> value {0, 0};
+                for (std::size_t l {0}; l < lanes; ++l) {
+                    if (better(m_value[l], m_index[l], value, best, count)) {
+                        best = m_index[l];
+                        value = m_value[l];
+                    } // end if
+                } // end for
+                for (std::size_t i {begin}; i < count; ++i) {
+                    if (better(f[i], i, value, best, count)) {
+                        best = i;
+                        value = f[i];
+                    } // end if
+                } // end for
+                return best;
+            }
+
+            Fraction<T> m_value [lanes];
+            std::size_t m_index [lanes];
+        };
+
+        // indexes of the first smallest and greatest Fractions (count if all are NaN)
+        template<typename T, bool Min, bool Max>
+        void extrema(Fraction<T> const* f, std::size_t count, std::size_t& smallest, std::size_t& greatest)
+        {
+            ExtremumLanes<T, false> low {count};
+            ExtremumLanes<T, true> high {count};
+            std::size_t const lanes {ExtremumLanes<T, false>::lanes};
+            std::size_t const end {(count / lanes) * lanes};
+            for (std::size_t i {0}; i < end; i += lanes) {
+                if (Min) {
+                    low.update(f, i, count);
+                } // end if
+                if (Max) {
+                    high.update(f, i, count);
+                } // end if
+            } // end for
+            smallest = Min ? low.result(f, end, count) : count;
+            greatest = Max ? high.result(f, end, count) : count;
+        }
+    } // end namespace detail
+
+    /// \fn    greater_mask
+    /// \brief mask of f[i] > x
+    /// \param the Fractions, and their number
+    /// \param the Fraction to be compared
+    /// \param destination mask ((count+63)/64 words)
+    template<typename T>
+    void greater_mask(Fraction<T> const* f, std::size_t count, Fraction<T> const& x, std::uint64_t* mask)
+    {
+        detail::buildMask(count, mask, [f, &x](std::size_t i) {return detail::wideGreater(f[i], x);});
+    }
+
+    /// \fn    less_mask
+    /// \brief mask of f[i] < x
+    /// \param the Fractions, and their number
+    /// \param the Fraction to be compared
+    /// \param destination mask ((count+63)/64 words)
+    template<typename T>
+    void less_mask(Fraction<T> const* f, std::size_t count, Fraction<T> const& x, std::uint64_t* mask)
+    {
+        detail::buildMask(count, mask, [f, &x](std::size_t i) {return detail::wideGreater(x, f[i]);});
+    }
+
+    /// \fn    equal_mask
+    /// \brief mask of f[i] == x
+    /// \param the Fractions, and their number
+    /// \param the Fraction to be compared
+    /// \param destination mask ((count+63)/64 words)
+    template<typename T>
+    void equal_mask(Fraction<T> const* f, std::size_t count, Fraction<T> const& x, std::uint64_t* mask)
+    {
+        detail::buildMask(count, mask, [f, &x](std::size_t i) {return detail::wideEqual(f[i], x);});
+    }
+
+    /// \fn    greater_mask
+    /// \brief mask of f1[i] > f2[i]
+    /// \param the two arrays of Fractions, and their number
+    /// \param destination mask ((count+63)/64 words)
+    template<typename T>
+    void greater_mask(Fraction<T> const* f1, Fraction<T> const* f2, std::size_t count, std::uint64_t* mask)
+    {
+        detail::buildMask(count, mask, [f1, f2](std::size_t i) {return detail::wideGreater(f1[i], f2[i]);});
+    }
+
+    /// \fn    less_mask
+    /// \brief mask of f1[i] < f2[i]
+    /// \param the two arrays of Fractions, and their number
+    /// \param destination mask ((count+63)/64 words)
+    template<typename T>
+    void less_mask(Fraction<T> const* f1, Fraction<T> const* f2, std::size_t count, std::uint64_t* mask)
+    {
+        detail::buildMask(count, mask, [f1, f2](std::size_t i) {return detail::wideGreater(f2[i], f1[i]);});
+    }
+
+    /// \fn    equal_mask
+    /// \brief mask of f1[i] == f2[i]
+    /// \param the two arrays of Fractions, and their number
+    /// \param destination mask ((count+63)/64 words)
+    template<typename T>
+    void equal_mask(Fraction<T> const* f1, Fraction<T> const* f2, std::size_t count, std::uint64_t* mask)
+    {
+        detail::buildMask(count, mask, [f1, f2](std::size_t i) {return detail::wideEqual(f1[i], f2[i]);});
+    }
+
+    /// \fn    argmin
+    /// \brief return the index of the first smallest Fraction (count if all are NaN)
+    /// \param the Fractions, and their number
+    template<typename T>
+    std::size_t argmin(Fraction<T> const* f, std::size_t count)
+    {
+        std::size_t smallest {0}, greatest {0};
+        detail::extrema<T, true, false>(f, count, smallest, greatest);
+        return smallest;
+    }
+
+    /// \fn    argmax
+    /// \brief return the index of the first greatest Fraction (count if all are NaN)
+    /// \param the Fractions, and their number
+    template<typename T>
+    std::size_t argmax(Fraction<T> const* f, std::size_t count)
+    {
+        std::size_t smallest {0}, greatest {0};
+        detail::extrema<T, false, true>(f, count, smallest, greatest);
+        return greatest;
+    }
+
+    /// \fn    min
+    /// \brief return the smallest Fraction (NaN if all are NaN)
+    /// \param the Fractions, and their number
+    template<typename T>
+    Fraction<T> min(Fraction<T> const* f, std::size_t count)
+    {
+        std::size_t const i {argmin(f, count)};
+        return (i == count) ? Fraction<T> {0, 0} : f[i];
+    }
+
+    /// \fn    max
+    /// \brief return the greatest Fraction (NaN if all are NaN)
+    /// \param the Fractions, and their number
+    template<typename T>
+    Fraction<T> max(Fraction<T> const* f, std::size_t count)
+    {
+        std::size_t const i {argmax(f, count)};
+        return (i == count) ? Fraction<T> {0, 0} : f[i];
+    }
+
+    /// \fn    minmax
+    /// \brief return the smallest and the greatest Fractions (NaN if all are NaN)
+    /// \param the Fractions, and their number
+    template<typename T>
+    std::pair<Fraction<T>, Fraction<T>> minmax(Fraction<T> const* f, std::size_t count)
+    {
+        std::size_t smallest {0}, greatest {0};
+        detail::extrema<T, true, true>(f, count, smallest, greatest);
+        if (smallest == count) {
+            return std::make_pair(Fraction<T> {0, 0}, Fraction<T> {0, 0});
+        } // end if
+        return std::make_pair(f[smallest], f[greatest]);
+    }
+
+} //end namespace
+#endif // FRACTION_KERNEL_HPP_INCLUDED
@@ -0,0 +1,205 @@
+#ifndef FRACTION_KEY_HPP_INCLUDED
+#define FRACTION_KEY_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "Fraction.hpp"
+
+///  \file   FractionKey.hpp
+///  \brief  Order preserving binary keys of Fractions: the keys compared with memcmp
+///          (shorter key first when one is a prefix of the other) are in the order of
+///          the values, so they can be stored and searched as they are (B-tree, LSM...).
+///          A key is a class byte:
+///            0x00 -Inf, 0x01 negative, 0x02 zero, 0x03 positive, 0x04 +Inf, 0x05 NaN,
+///          followed, for a positive value, by the terms of its continued fraction
+///          [a0; a1, ..., an] (the path in the Stern-Brocot tree), the last term being
+///          at least 2 (except for an integer), then by a terminator.
+///          A term lower than 0xF7 is one byte, a greater term is a byte 0xF6+length
+///          followed by its length bytes (big endian). The terminator is 0xFF.
+///          The value increases with a0, a2, ... and decreases with a1, a3, ..., so the
+///          bytes of the odd positions (terms and terminator) are inverted.
+///          A negative value has the key of its absolute value, with all the bytes inverted.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+
+    /// \var   maxKeySize
+    /// \brief maximal number of bytes of the key of a Fraction<T>
+    ///        (class and terminator, the terms of the continued fraction (as many as the
+    ///        Fibonacci numbers up to 2^digits), and the length bytes of the long terms)
+    template<typename T>
+    constexpr std::size_t maxKeySize()
+    {
+        return 2 + ((std::numeric_limits<T>::digits * 3) / 2) + 3 + (2 * ((std::numeric_limits<T>::digits + 7) / 8));
+    }
+
+    namespace detail {
+        enum KeyClass : std::uint8_t {KeyNegInf, KeyNegative, KeyZero, KeyPositive, KeyPosInf, KeyNan};
+
+        // write one term of the continued fraction (mask 0xFF: inverted bytes), return the number of bytes
+        inline std::size_t putKeyTerm(std::uint64_t t, std::uint8_t mask, std::uint8_t* dst)
+        {
+            if (t < 0xF7) {
+                dst[0] = static_cast<std::uint8_t>(t ^ mask);
+                return 1;
+            } // end if
+            std::size_t const length {static_cast<std::size_t>((bitLength(t) + 7) / 8)};
+            dst[0] = static_cast<std::uint8_t>((0xF6 + length) ^ mask);
+            for (std::size_t i {0}; i < length; ++i) {
+                dst[length - i] = static_cast<std::uint8_t>((t >> (8 * i)) ^ mask);
+            } // end for
+            return length + 1;
+        }
+
+        // key of p/q (p and q not null), written after the class byte
+        inline std::size_t putKeyTerms(std::uint64_t p, std::uint64_t q, std::uint8_t mask, std::uint8_t* dst)
+        {
+            std::size_t n {0};
+            while (true) {
+                std::uint64_t const r {p % q};
+                n += putKeyTerm(p / q, mask, dst + n);
+                mask = static_cast<std::uint8_t>(~mask);
+                if (r == 0) {
+                    break;
+                } // end if
+                p = q;
+                q = r;
+            } // end while
+            dst[n++] = static_cast<std::uint8_t>(0xFF ^ mask);
+            return n;
+        }
+    } // end namespace detail
+
+    /// \fn    encode_key
+    /// \brief Key of a Fraction
+    /// \param the Fraction
+    /// \param destination buffer (at least maxKeySize<T>() bytes)
+    /// \return number of bytes written
+    template<typename T>
+    std::size_t encode_key(Fraction<T> const& f, std::uint8_t* dst)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        T const num {f.num()};
+        if (f.den() == 0) {
+            dst[0] = (num == 0) ? detail::KeyNan : ((num < 0) ? detail::KeyNegInf : detail::KeyPosInf);
+            return 1;
+        } else if (num == 0) {
+            dst[0] = detail::KeyZero;
+            return 1;
+        } // end if
+        std::uint8_t const mask {static_cast<std::uint8_t>((num < 0) ? 0xFF : 0x00)};
+        dst[0] = (num < 0) ? detail::KeyNegative : detail::KeyPositive;
+        return 1 + detail::putKeyTerms(detail::magnitude(num), detail::magnitude(f.den()), mask, dst + 1);
+    }
+
+    /// \fn    encode_key
+    /// \brief Keys of an array of Fractions, written one after the other
+    /// \param the Fractions, and their number
+    /// \param destination buffer (at least count*maxKeySize<T>() bytes)
+    /// \param offsets of the keys in the buffer (count+1 values, the last one is the end)
+    /// \return number of bytes written
+    template<typename T>
+    std::size_t encode_key(Fraction<T> const* src, std::size_t count, std::uint8_t* dst, std::size_t* offsets)
+    {
+        std::size_t n {0};
+        for (std::size_t i {0}; i < count; ++i) {
+            offsets[i] = n;
+            n += encode_key(src[i], dst + n);
+        } // end for
+        offsets[count] = n;
+        return n;
+    }
+
+    /// \fn    decode_key
+    /// \brief Fraction of a key
+    /// \param source buffer and end of the source buffer
+    /// \param the decoded Fraction
+    /// \return number of bytes read (0 if the key is truncated, malformed, or out of the range of T)
+    template<typename T>
+    std::size_t decode_key(std::uint8_t const* src, std::uint8_t const* end, Fraction<T>& f)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        if (src >= end) {
+            return 0;
+        } // end if
+        switch (*src) {
+        case detail::KeyNegInf:
+            f = Fraction<T>::from_reduced(-1, 0);
+            return 1;
+        case detail::KeyZero:
+            f = Fraction<T> {0};
+            return 1;
+        case detail::KeyPosInf:
+            f = Fraction<T>::from_reduced(1, 0);
+            return 1;
+        case detail::KeyNan:
+            f = Fraction<T>::from_reduced(0, 0);
+            return 1;
+        case detail::KeyNegative:
+        case detail::KeyPositive:
+            break;
+        default:
+            return 0;
+        } // end switch
+        bool const negative {*src == detail::KeyNegative};
+        std::uint8_t mask {static_cast<std::uint8_t>(negative ? 0xFF : 0x00)};
+        std::uint64_t const limit {static_cast<std::uint64_t>(std::numeric_limits<T>::max())};
+        // h1/k1 and h0/k0: the two last convergents
+        std::uint64_t h0 {0}, k0 {1}, h1 {1}, k1 {0};
+        std::uint64_t last {0};
+        std::size_t terms {0};
+        std::uint8_t const* p {src + 1};
+        while (true) {
+            if (p >= end) {
+                return 0;
+            } // end if
+            std::uint8_t const b {static_cast<std::uint8_t>(*p++ ^ mask)};
+            if (b == 0xFF) {
+                break;
+            } // end if
+            std::uint64_t t {b};
+            if (b >= 0xF7) {
+                std::size_t const length {static_cast<std::size_t>(b - 0xF6)};
+                if (length > static_cast<std::size_t>(end - p)) {
+                    return 0;
+                } // end if
+                t = 0;
+                for (std::size_t i {0}; i < length; ++i) {
+                    t = (t << 8) | static_cast<std::uint8_t>(*p++ ^ mask);
+                } // end for
+                // canonical form only: a short term, or leading null bytes, are malformed
+                if ((t < 0xF7) || (length != static_cast<std::size_t>((detail::bitLength(t) + 7) / 8))) {
+                    return 0;
+                } // end if
+            } // end if
+            if ((terms > 0) && (t == 0)) {
+                return 0;
+            } // end if
+            detail::uint128 const h2 {(static_cast<detail::uint128>(t) * h1) + h0};
+            detail::uint128 const k2 {(static_cast<detail::uint128>(t) * k1) + k0};
+            if ((h2 > limit) || (k2 > limit)) {
+                return 0;
+            } // end if
+            h0 = h1;
+            k0 = k1;
+            h1 = static_cast<std::uint64_t>(h2);
+            k1 = static_cast<std::uint64_t>(k2);
+            last = t;
+            ++terms;
+            mask = static_cast<std::uint8_t>(~mask);
+        } // end while
+        // canonical form only (one key per value): not null, and a last term 1 is merged
+        if ((terms == 0) || (h1 == 0) || ((terms > 1) && (last == 1))) {
+            return 0;
+        } // end if
+        // the convergents of a continued fraction are reduced
+        T const num {static_cast<T>(negative ? -static_cast<T>(h1) : static_cast<T>(h1))};
+        f = Fraction<T>::from_reduced(num, static_cast<T>(k1));
+        return static_cast<std::size_t>(p - src);
+    }
+
+} //end namespace
+#endif // FRACTION_KEY_HPP_INCLUDED
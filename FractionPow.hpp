@@ -0,0 +1,93 @@
+#ifndef FRACTION_POW_HPP_INCLUDED
+#define FRACTION_POW_HPP_INCLUDED
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "Fraction.hpp"
+
+///  \file   FractionPow.hpp
+///  \brief  Integer powers of Fractions, by binary exponentiation (squaring).
+///          The powers of a reduced Fraction p/q are reduced (p^n and q^n have no common
+///          divisor), so there is no gcd: the numerator and the denominator are raised
+///          separately, in integers twice as wide as T, and the result is NaN when it
+///          does not fit in T.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // v^n (v > 0), or 0 when it is greater than limit
+        template<typename T>
+        std::uint64_t powMagnitude(std::uint64_t v, unsigned n, std::uint64_t limit)
+        {
+            typedef typename WideProduct<T>::unsignedType Unsigned;
+            Unsigned result {1};
+            Unsigned base {v};
+            while (true) {
+                if ((n & 1) != 0) {
+                    // result >= 1: the product is greater than base (and both factors are
+                    // at most limit, so the product does not wrap)
+                    if (base > limit) {
+                        return 0;
+                    } // end if
+                    result = result * base;
+                    if (result > limit) {
+                        return 0;
+                    } // end if
+                } // end if
+                n >>= 1;
+                if (n == 0) {
+                    return static_cast<std::uint64_t>(result);
+                } else if (base > limit) {
+                    // base^2 is needed, and v >= 1: the result is greater than base
+                    return 0;
+                } // end if
+                base = base * base;
+            } // end while
+        }
+    } // end namespace detail
+
+    /// \fn    pow
+    /// \brief return f^n (f^0 is 1; 0 raised to a negative power is Inf, Inf raised to
+    ///        a negative power is 0, NaN if the result does not fit in T)
+    /// \param the Fraction, and the exponent
+    template<typename T>
+    Fraction<T> pow(Fraction<T> const& f, int n)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        if (n == 0) {
+            return Fraction<T> {1};
+        } // end if
+        unsigned const e {(n < 0) ? (0u - static_cast<unsigned>(n)) : static_cast<unsigned>(n)};
+        bool const negative {(f.num() < 0) && ((e & 1) != 0)};
+        T const sign {static_cast<T>(negative ? -1 : 1)};
+        if (f.den() == 0) {
+            // NaN, or (+/-Inf)^n: +/-Inf for n > 0, and 0 for n < 0
+            if ((f.num() == 0) || (n > 0)) {
+                return Fraction<T>::from_reduced((f.num() == 0) ? T(0) : sign, 0);
+            } // end if
+            return Fraction<T> {0};
+        } else if (f.num() == 0) {
+            return (n > 0) ? Fraction<T> {0} : Fraction<T>::from_reduced(1, 0);
+        } // end if
+        // the magnitude of a negative numerator can be max()+1 (the minimum of T)
+        std::uint64_t const limit {static_cast<std::uint64_t>(std::numeric_limits<T>::max())};
+        std::uint64_t const numLimit {negative ? (limit + 1) : limit};
+        std::uint64_t p {detail::magnitude(f.num())};
+        std::uint64_t q {detail::magnitude(f.den())};
+        if (n < 0) {
+            std::uint64_t const r {p};
+            p = q;
+            q = r;
+        } // end if
+        std::uint64_t const num {detail::powMagnitude<T>(p, e, numLimit)};
+        std::uint64_t const den {detail::powMagnitude<T>(q, e, limit)};
+        if ((num == 0) || (den == 0)) {
+            return Fraction<T>::from_reduced(0, 0);
+        } // end if
+        return Fraction<T>::from_reduced(negative ? static_cast<T>(std::uint64_t{0} - num) : static_cast<T>(num), static_cast<T>(den));
+    }
+
+} //end namespace
+#endif // FRACTION_POW_HPP_INCLUDED
@@ -0,0 +1,155 @@
+#ifndef FRACTION_PRODUCT_TREE_HPP_INCLUDED
+#define FRACTION_PRODUCT_TREE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "BigInt.hpp"
+#include "Fraction.hpp"
+
+///  \file   FractionProductTree.hpp
+///  \brief  Batch GCD and common denominators of many Fractions, with balanced trees
+///          (D. J. Bernstein, "How to find smooth parts of integers"):
+///            - the product tree holds the products of the pairs of values, then of the
+///              pairs of products, up to the product of all the values,
+///            - the remainder tree takes a value modulo the nodes, from the root to the
+///              leaves, so each leaf gets its remainder with divisions of similar sizes.
+///          batch_gcd gives the gcd of each value with the product of all the others.
+///          The lcm tree is the same tree with lcm instead of products: its root is the
+///          common denominator of a column, and the cofactors L/d are computed down the
+///          tree, so the column is rescaled without a division of L by each denominator.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // levels of a tree: level 0 holds the leaves, level k+1 the combinations of the pairs
+        // of level k (the last node of an odd level is copied), the last level is the root
+        template<typename Combine>
+        std::vector<std::vector<BigInt>> buildTree(std::vector<BigInt> leaves, Combine combine)
+        {
+            std::vector<std::vector<BigInt>> levels;
+            levels.push_back(std::move(leaves));
+            while (levels.back().size() > 1) {
+                std::vector<BigInt> const& below {levels.back()};
+                std::vector<BigInt> level ((below.size() + 1) / 2);
+                for (std::size_t i {0}; i < level.size(); ++i) {
+                    level[i] = ((2 * i) + 1 < below.size()) ? combine(below[2 * i], below[(2 * i) + 1]) : below[2 * i];
+                } // end for
+                levels.push_back(std::move(level));
+            } // end while
+            return levels;
+        }
+
+        inline BigInt multiplyNodes(BigInt const& a, BigInt const& b)
+        {
+            return a * b;
+        }
+
+        inline BigInt lcmNodes(BigInt const& a, BigInt const& b)
+        {
+            return (a / BigInt::gcd(a, b)) * b;
+        }
+
+        inline std::uint64_t gcd64(std::uint64_t a, std::uint64_t b)
+        {
+            while (b != 0) {
+                std::uint64_t const r {a % b};
+                a = b;
+                b = r;
+            } // end while
+            return a;
+        }
+    } // end namespace detail
+
+    /// \fn    product_tree
+    /// \brief return the levels of the product tree of integers (level 0: the values, last
+    ///        level: their product)
+    /// \param the integers, and their number
+    template<typename T>
+    std::vector<std::vector<BigInt>> product_tree(T const* values, std::size_t count)
+    {
+        std::vector<BigInt> leaves (count);
+        for (std::size_t i {0}; i < count; ++i) {
+            leaves[i] = BigInt {static_cast<std::int64_t>(values[i])};
+        } // end for
+        if (count == 0) {
+            leaves.push_back(BigInt {1});
+        } // end if
+        return detail::buildTree(std::move(leaves), detail::multiplyNodes);
+    }
+
+    /// \fn    batch_gcd
+    /// \brief gcd of each value with the product of all the other values: the product P is
+    ///        taken modulo the squares of the nodes of its tree, down to P mod x^2 for each
+    ///        leaf x, and gcd(x, P/x) = gcd(x, (P mod x^2)/x)
+    /// \param the integers (their sign is ignored, not the smallest value of T), and their number
+    /// \param destination array (0 for a null value)
+    template<typename T>
+    void batch_gcd(T const* values, std::size_t count, T* out)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        std::vector<std::int64_t> magnitudes (count);
+        for (std::size_t i {0}; i < count; ++i) {
+            // the product of the others is made without the null values
+            magnitudes[i] = (values[i] == 0) ? 1 : static_cast<std::int64_t>(detail::magnitude(values[i]));
+        } // end for
+        std::vector<std::vector<BigInt>> const tree {product_tree(magnitudes.data(), count)};
+        // remainders of the root, from the level below the root to the leaves
+        std::vector<BigInt> remainders {tree.back()};
+        for (std::size_t level {tree.size() - 1}; level > 0; --level) {
+            std::vector<BigInt> const& nodes {tree[level - 1]};
+            std::vector<BigInt> next (nodes.size());
+            for (std::size_t i {0}; i < nodes.size(); ++i) {
+                next[i] = remainders[i / 2] % (nodes[i] * nodes[i]);
+            } // end for
+            remainders.swap(next);
+        } // end for
+        for (std::size_t i {0}; i < count; ++i) {
+            std::uint64_t const x {static_cast<std::uint64_t>(magnitudes[i])};
+            std::uint64_t const cofactor {static_cast<std::uint64_t>((remainders[i] / BigInt {magnitudes[i]}).toInt64())};
+            out[i] = (values[i] == 0) ? T(0) : static_cast<T>(detail::gcd64(x, cofactor));
+        } // end for
+    }
+
+    /// \fn    common_denominator
+    /// \brief return the lcm of the denominators of a column of Fractions (balanced lcm
+    ///        tree), and rescale the numerators to it: f[i] = nums[i]/lcm
+    /// \param the Fractions (finite), and their number
+    /// \param destination array of the numerators (nullptr: only the lcm is computed)
+    template<typename T>
+    BigInt common_denominator(Fraction<T> const* f, std::size_t count, BigInt* nums)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        std::vector<BigInt> leaves (count);
+        for (std::size_t i {0}; i < count; ++i) {
+            leaves[i] = BigInt {static_cast<std::int64_t>(f[i].den())};
+        } // end for
+        if (count == 0) {
+            leaves.push_back(BigInt {1});
+        } // end if
+        std::vector<std::vector<BigInt>> const tree {detail::buildTree(std::move(leaves), detail::lcmNodes)};
+        if (nums == nullptr) {
+            return tree.back()[0];
+        } // end if
+        // cofactors L/node, from the root (1) to the leaves: L/child = (L/parent)*(parent/child)
+        std::vector<BigInt> cofactors {BigInt {1}};
+        for (std::size_t level {tree.size() - 1}; level > 0; --level) {
+            std::vector<BigInt> const& parents {tree[level]};
+            std::vector<BigInt> const& nodes {tree[level - 1]};
+            std::vector<BigInt> next (nodes.size());
+            for (std::size_t i {0}; i < nodes.size(); ++i) {
+                BigInt const& parent {parents[i / 2]};
+                next[i] = (parent == nodes[i]) ? cofactors[i / 2] : (cofactors[i / 2] * (parent / nodes[i]));
+            } // end for
+            cofactors.swap(next);
+        } // end for
+        for (std::size_t i {0}; i < count; ++i) {
+            nums[i] = cofactors[i] * BigInt {static_cast<std::int64_t>(f[i].num())};
+        } // end for
+        return tree.back()[0];
+    }
+
+} //end namespace
+#endif // FRACTION_PRODUCT_TREE_HPP_INCLUDED
@@ -0,0 +1,526 @@
+#ifndef FRACTION_PROGRAM_HPP_INCLUDED
+#define FRACTION_PROGRAM_HPP_INCLUDED
+
+#include <cctype>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Fraction.hpp"
+
+///  \file   FractionProgram.hpp
+///  \brief  Compiled expressions on Fractions, as "(x + 1/3) * y / (z - 2)".
+///          An expression (infix, or RPN) is parsed once, its constant sub-expressions
+///          are folded, and it is compiled into a register based bytecode. The bytecode
+///          is run on columns of Fractions by blocks of rows: each instruction is a loop
+///          on the rows of the block, so the interpretation cost is paid once per block.
+///          As the rest of the library, no exception: compile() returns false, and
+///          error() describes the problem (the program then gives NaN for every row).
+///  \author Dedeun
+///  \date   16 oct 2026
+
+///  \class FractionProgram
+///  \brief Expression on Fraction variables, compiled into bytecode
+namespace dd {
+    template<typename T>
+    class FractionProgram final {
+    public:
+        /// \var   blockSize
+        /// \brief number of rows computed by each instruction of the bytecode
+        static std::size_t const blockSize {256};
+
+        /// \fn    FractionProgram ();
+        /// \brief Constructor (empty program)
+        FractionProgram (): m_variables{0}, m_temporaries{0}, m_result{0}, m_compiled{false}
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+        }
+
+        /// \fn    compile
+        /// \brief Compile an infix expression: integers, variables, + - * / (and unary -),
+        ///        and parentheses
+        /// \param the expression
+        /// \param the names of the variables (their order is the order of the columns)
+        /// \return false if the expression is not valid (see error())
+        bool compile(std::string const& expression, std::vector<std::string> const& variables)
+        {
+            clear(variables);
+            Parser parser {*this, expression};
+            std::size_t root {0};
+            if (!parser.expression(root)) {
+                return false;
+            } else if (parser.next().m_kind != Token::End) {
+                return fail("unexpected '" + parser.next().m_text + "'");
+            } // end if
+            generate(root);
+            return true;
+        }
+
+        /// \fn    compileRpn
+        /// \brief Compile an expression in reverse Polish notation (tokens separated by
+        ///        spaces: integers, variables, + - * /, and "neg" for the unary -)
+        /// \param the expression
+        /// \param the names of the variables (their order is the order of the columns)
+        /// \return false if the expression is not valid (see error())
+        bool compileRpn(std::string const& expression, std::vector<std::string> const& variables)
+        {
+            clear(variables);
+            std::istringstream flux {expression};
+            std::vector<std::size_t> stack;
+            std::string word;
+            while (flux >> word) {
+                std::size_t node {0};
+                if ((word == "+") || (word == "-") || (word == "*") || (word == "/")) {
+                    if (stack.size() < 2) {
+                        return fail("missing operand for '" + word + "'");
+                    } // end if
+                    std::size_t const right {stack.back()};
+                    stack.pop_back();
+                    node = binary(word[0], stack.back(), right);
+                    stack.pop_back();
+                } else if (word == "neg") {
+                    if (stack.empty()) {
+                        return fail("missing operand for 'neg'");
+                    } // end if
+                    node = negate(stack.back());
+                    stack.pop_back();
+                } else if (!leaf(word, node)) {
+                    return false;
+                } // end if
+                stack.push_back(node);
+            } // end while
+            if (stack.size() != 1) {
+                return fail(stack.empty() ? "empty expression" : "missing operator");
+            } // end if
+            generate(stack.back());
+            return true;
+        }
+
+        /// \fn    error
+        /// \brief return the description of the last compilation error
+        std::string const& error() const
+        {
+            return m_error;
+        }
+
+        /// \fn    compiled
+        /// \brief return true if the last compilation succeeded
+        bool compiled() const
+        {
+            return m_compiled;
+        }
+
+        /// \fn    size
+        /// \brief return the number of instructions of the bytecode
+        std::size_t size() const
+        {
+            return m_code.size();
+        }
+
+        /// \fn    run
+        /// \brief Evaluate the expression on each row of the columns
+        ///        (NaN for every row if the program is not compiled)
+        /// \param the columns (one per variable, in the order of the compilation)
+        /// \param number of rows
+        /// \param destination (one Fraction per row)
+        void run(Fraction<T> const* const* columns, std::size_t rows, Fraction<T>* out) const
+        {
+            if (!m_compiled) {
+                for (std::size_t i {0}; i < rows; ++i) {
+                    out[i] = Fraction<T>::from_reduced(0, 0);
+                } // end for
+                return;
+            } // end if
+            std::vector<Fraction<T>> temporaries (m_temporaries * blockSize);
+            std::vector<Fraction<T> const*> registers (m_registers.size());
+            for (std::size_t begin {0}; begin < rows; begin += blockSize) {
+                std::size_t const count {((rows - begin) < blockSize) ? (rows - begin) : blockSize};
+                // registers of this block: a column, a constant, or a temporary array
+                for (std::size_t r {0}; r < m_registers.size(); ++r) {
+                    Register const& reg {m_registers[r]};
+                    registers[r] = (reg.m_kind == Variable) ? (columns[reg.m_index] + begin) :
+                                   ((reg.m_kind == Constant) ? &reg.m_value : &temporaries[reg.m_index * blockSize]);
+                } // end for
+                for (Instruction const& code : m_code) {
+                    Fraction<T>* const dst {&temporaries[m_registers[code.m_dst].m_index * blockSize]};
+                    execute(code.m_op, dst, registers[code.m_a], m_registers[code.m_a].m_kind == Constant,
+                            registers[code.m_b], m_registers[code.m_b].m_kind == Constant, count);
+                } // end for
+                Fraction<T> const* const result {registers[m_result]};
+                bool const constant {m_registers[m_result].m_kind == Constant};
+                for (std::size_t i {0}; i < count; ++i) {
+                    out[begin + i] = constant ? result[0] : result[i];
+                } // end for
+            } // end for
+        }
+
+        /// \fn    evaluate
+        /// \brief return the value of the expression for one row (NaN if the program is not
+        ///        compiled)
+        /// \param the values of the variables
+        Fraction<T> evaluate(Fraction<T> const* values) const
+        {
+            std::vector<Fraction<T> const*> columns (m_variables);
+            for (std::size_t v {0}; v < m_variables; ++v) {
+                columns[v] = values + v;
+            } // end for
+            Fraction<T> f {};
+            run(columns.data(), 1, &f);
+            return f;
+        }
+
+    protected:
+    private:
+        enum Kind {Variable, Constant, Temporary};
+
+        // register: a variable (column index), a constant, or a temporary (array index)
+        struct Register {
+            Kind m_kind;
+            std::size_t m_index;
+            Fraction<T> m_value;
+        };
+
+        // instruction: dst = a op b
+        struct Instruction {
+            char m_op;
+            std::size_t m_dst;
+            std::size_t m_a;
+            std::size_t m_b;
+        };
+
+        // node of the syntax tree: a leaf (register), or an operation
+        struct Node {
+            char m_op;
+            std::size_t m_register;
+            std::size_t m_left;
+            std::size_t m_right;
+        };
+
+        // token of an infix expression
+        struct Token {
+            enum TokenKind {Number, Name, Symbol, End} m_kind;
+            std::string m_text;
+        };
+
+        // recursive descent parser of the infix expressions
+        class Parser {
+        public:
+            Parser (FractionProgram<T>& program, std::string const& text): m_program(program), m_text(text), m_position{0}
+            {
+                read();
+            }
+
+            Token const& next() const
+            {
+                return m_token;
+            }
+
+            // expression := term (('+' | '-') term)*
+            bool expression(std::size_t& node)
+            {
+                if (!term(node)) {
+                    return false;
+                } // end if
+                while ((m_token.m_text == "+") || (m_token.m_text == "-")) {
+                    char const op {m_token.m_text[0]};
+                    read();
+                    std::size_t right {0};
+                    if (!term(right)) {
+                        return false;
+                    } // end if
+                    node = m_program.binary(op, node, right);
+                } // end while
+                return true;
+            }
+
+        private:
+            // term := unary (('*' | '/') unary)*
+            bool term(std::size_t& node)
+            {
+                if (!unary(node)) {
+                    return false;
+                } // end if
+                while ((m_token.m_text == "*") || (m_token.m_text == "/")) {
+                    char const op {m_token.m_text[0]};
+                    read();
+                    std::size_t right {0};
+                    if (!unary(right)) {
+                        return false;
+                    } // end if
+                    node = m_program.binary(op, node, right);
+                } // end while
+                return true;
+            }
+
+            // unary := '-' unary | primary
+            // primary := number | name | '(' expression ')'
+            bool unary(std::size_t& node)
+            {
+                if (m_token.m_text == "-") {
+                    read();
+                    if (!unary(node)) {
+                        return false;
+                    } // end if
+                    node = m_program.negate(node);
+                    return true;
+                } else if (m_token.m_text == "(") {
+                    read();
+                    if (!expression(node)) {
+                        return false;
+                    } else if (m_token.m_text != ")") {
+                        return m_program.fail("missing ')'");
+                    } // end if
+                    read();
+                    return true;
+                } else if ((m_token.m_kind == Token::Number) || (m_token.m_kind == Token::Name)) {
+                    if (!m_program.leaf(m_token.m_text, node)) {
+                        return false;
+                    } // end if
+                    read();
+                    return true;
+                } // end if
+                return m_program.fail((m_token.m_kind == Token::End) ? "unexpected end" : ("unexpected '" + m_token.m_text + "'"));
+            }
+
+            // next token
+            void read()
+            {
+                while ((m_position < m_text.size()) && std::isspace(static_cast<unsigned char>(m_text[m_position]))) {
+                    ++m_position;
+                } // end while
+                std::size_t const begin {m_position};
+                if (m_position == m_text.size()) {
+                    m_token = Token {Token::End, ""};
+                    return;
+                } // end if
+                unsigned char const c {static_cast<unsigned char>(m_text[m_position])};
+                if (std::isdigit(c)) {
+                    while ((m_position < m_text.size()) && std::isdigit(static_cast<unsigned char>(m_text[m_position]))) {
+                        ++m_position;
+                    } // end while
+                    m_token = Token {Token::Number, m_text.substr(begin, m_position - begin)};
+                } else if (std::isalpha(c) || (c == '_')) {
+                    while ((m_position < m_text.size()) && (std::isalnum(static_cast<unsigned char>(m_text[m_position])) ||
+                           (m_text[m_position] == '_'))) {
+                        ++m_position;
+                    } // end while
+                    m_token = Token {Token::Name, m_text.substr(begin, m_position - begin)};
+                } else {
+                    ++m_position;
+                    m_token = Token {Token::Symbol, m_text.substr(begin, 1)};
+                } // end if
+            }
+
+            FractionProgram<T>& m_program;
+            std::string const& m_text;
+            std::size_t m_position;
+            Token m_token;
+        };
+
+        // reset the program
+        void clear(std::vector<std::string> const& variables)
+        {
+            m_names = variables;
+            m_variables = variables.size();
+            m_registers.clear();
+            m_nodes.clear();
+            m_code.clear();
+            m_error.clear();
+            m_temporaries = 0;
+            m_result = 0;
+            m_compiled = false;
+            for (std::size_t v {0}; v < m_variables; ++v) {
+                m_registers.push_back(Register {Variable, v, Fraction<T> {}});
+            } // end for
+        }
+
+        bool fail(std::string const& message)
+        {
+            if (m_error.empty()) {
+                m_error = message;
+            } // end if
+            return false;
+        }
+
+        // leaf of the tree: a variable, or an integer constant
+        bool leaf(std::string const& word, std::size_t& node)
+        {
+            if (std::isdigit(static_cast<unsigned char>(word[0]))) {
+                T value {0};
+                for (char const c : word) {
+                    if (!std::isdigit(static_cast<unsigned char>(c))) {
+                        return fail("invalid number '" + word + "'");
+                    } // end if
+                    T const digit {static_cast<T>(c - '0')};
+                    if (value > ((std::numeric_limits<T>::max() - digit) / 10)) {
+                        return fail("number out of range '" + word + "'");
+                    } // end if
+                    value = static_cast<T>((value * 10) + digit);
+                } // end for
+                node = constant(Fraction<T> {value});
+                return true;
+            } // end if
+            for (std::size_t v {0}; v < m_variables; ++v) {
+                if (m_names[v] == word) {
+                    m_nodes.push_back(Node {0, v, 0, 0});
+                    node = m_nodes.size() - 1;
+                    return true;
+                } // end if
+            } // end for
+            return fail("unknown variable '" + word + "'");
+        }
+
+        std::size_t constant(Fraction<T> const& value)
+        {
+            m_registers.push_back(Register {Constant, 0, value});
+            m_nodes.push_back(Node {0, m_registers.size() - 1, 0, 0});
+            return m_nodes.size() - 1;
+        }
+
+        bool isConstant(std::size_t node) const
+        {
+            return ((m_nodes[node].m_op == 0) && (m_registers[m_nodes[node].m_register].m_kind == Constant));
+        }
+
+        // operation node (folded when both operands are constants)
+        std::size_t binary(char op, std::size_t left, std::size_t right)
+        {
+            if (isConstant(left) && isConstant(right)) {
+                Fraction<T> const a {m_registers[m_nodes[left].m_register].m_value};
+                Fraction<T> const b {m_registers[m_nodes[right].m_register].m_value};
+                return constant(compute(op, a, b));
+            } // end if
+            m_nodes.push_back(Node {op, 0, left, right});
+            return m_nodes.size() - 1;
+        }
+
+        // -x is 0 - x (the same result, also for Inf and NaN)
+        std::size_t negate(std::size_t node)
+        {
+            return binary('-', constant(Fraction<T> {0}), node);
+        }
+
+        static Fraction<T> compute(char op, Fraction<T> const& a, Fraction<T> const& b)
+        {
+            switch (op) {
+            case '+':
+                return a + b;
+            case '-':
+                return a - b;
+            case '*':
+                return a * b;
+            default:
+                return a / b;
+            } // end switch
+        }
+
+        // bytecode of the tree: the register of a node is its leaf register, or a temporary
+        // (the temporaries of the operands are released when the operation is done)
+        void generate(std::size_t root)
+        {
+            std::vector<std::size_t> freeTemporaries;
+            m_result = emit(root, freeTemporaries);
+            m_compiled = true;
+        }
+
+        std::size_t emit(std::size_t node, std::vector<std::size_t>& freeTemporaries)
+        {
+            Node const n {m_nodes[node]};
+            if (n.m_op == 0) {
+                return n.m_register;
+            } // end if
+            std::size_t const a {emit(n.m_left, freeTemporaries)};
+            std::size_t const b {emit(n.m_right, freeTemporaries)};
+            for (std::size_t const r : {b, a}) {
+                if (m_registers[r].m_kind == Temporary) {
+                    freeTemporaries.push_back(r);
+                } // end if
+            } // end for
+            std::size_t dst {0};
+            if (freeTemporaries.empty()) {
+                m_registers.push_back(Register {Temporary, m_temporaries++, Fraction<T> {}});
+                dst = m_registers.size() - 1;
+            } else {
+                dst = freeTemporaries.back();
+                freeTemporaries.pop_back();
+            } // end if
+            m_code.push_back(Instruction {n.m_op, dst, a, b});
+            return dst;
+        }
+
+        // dst[i] = a[i] op b[i] (a constant operand is a single value): one loop per case,
+        // so the operation is chosen once per block
+        template<typename Op>
+        static void kernel(Op op, Fraction<T>* dst, Fraction<T> const* a, bool constantA,
+                           Fraction<T> const* b, bool constantB, std::size_t count)
+        {
+            if (constantA) {
+                Fraction<T> const x {a[0]};
+                for (std::size_t i {0}; i < count; ++i) {
+                    dst[i] = op(x, b[i]);
+                } // end for
+            } else if (constantB) {
+                Fraction<T> const y {b[0]};
+                for (std::size_t i {0}; i < count; ++i) {
+                    dst[i] = op(a[i], y);
+                } // end for
+            } else {
+                for (std::size_t i {0}; i < count; ++i) {
+                    dst[i] = op(a[i], b[i]);
+                } // end for
+            } // end if
+        }
+
+        static void execute(char op, Fraction<T>* dst, Fraction<T> const* a, bool constantA,
+                            Fraction<T> const* b, bool constantB, std::size_t count)
+        {
+            switch (op) {
+            case '+':
+                kernel([](Fraction<T> const& x, Fraction<T> const& y) {return x + y;}, dst, a, constantA, b, constantB, count);
+                break;
+            case '-':
+                kernel([](Fraction<T> const& x, Fraction<T> const& y) {return x - y;}, dst, a, constantA, b, constantB, count);
+                break;
+            case '*':
+                kernel([](Fraction<T> const& x, Fraction<T> const& y) {return x * y;}, dst, a, constantA, b, constantB, count);
+                break;
+            default:
+                kernel([](Fraction<T> const& x, Fraction<T> const& y) {return x / y;}, dst, a, constantA, b, constantB, count);
+                break;
+            } // end switch
+        }
+
+        /// \var   m_names
+        /// \brief member variable: names of the variables
+        std::vector<std::string> m_names;
+        /// \var   m_variables
+        /// \brief member variable: number of variables
+        std::size_t m_variables;
+        /// \var   m_registers
+        /// \brief member variable: registers (variables, constants, then temporaries)
+        std::vector<Register> m_registers;
+        /// \var   m_nodes
+        /// \brief member variable: syntax tree (used by the compilation)
+        std::vector<Node> m_nodes;
+        /// \var   m_code
+        /// \brief member variable: bytecode
+        std::vector<Instruction> m_code;
+        /// \var   m_temporaries
+        /// \brief member variable: number of temporary registers
+        std::size_t m_temporaries;
+        /// \var   m_result
+        /// \brief member variable: register of the result
+        std::size_t m_result;
+        /// \var   m_compiled
+        /// \brief member variable: true if the last compilation succeeded
+        bool m_compiled;
+        /// \var   m_error
+        /// \brief member variable: last compilation error
+        std::string m_error;
+    }; // end class
+
+} //end namespace
+#endif // FRACTION_PROGRAM_HPP_INCLUDED
@@ -0,0 +1,149 @@
+#ifndef FRACTION_ROOT_HPP_INCLUDED
+#define FRACTION_ROOT_HPP_INCLUDED
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "Fraction.hpp"
+#include "FractionSternBrocot.hpp"
+
+///  \file   FractionRoot.hpp
+///  \brief  Rational approximations of the square roots and of the nth roots of Fractions.
+///          The root of p/q is computed on the grid of the Fractions R/D, with a bounded
+///          denominator D chosen from the requested error: R is the integer nth root of
+///          p*D^n/q, found by Newton's iteration on 128 bits integers (started from a
+///          floating point estimate, so it converges in a few quadratic steps).
+///          The result is then the simplest Fraction of the interval allowed by the error
+///          around R/D, so its denominator stays small.
+///          The exact root is returned when p and q are perfect powers.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // x^n in r, or false if it is greater than 2^128 - 1
+        inline bool powWide(uint128 x, unsigned n, uint128& r)
+        {
+            uint128 const max {~uint128{0}};
+            if (x < 2) {
+                r = x;
+                return true;
+            } // end if
+            r = 1;
+            for (unsigned i {0}; i < n; ++i) {
+                if (r > (max / x)) {
+                    return false;
+                } // end if
+                r *= x;
+            } // end for
+            return true;
+        }
+
+        // floor of the nth root of v (n >= 1): Newton's iteration, from a value not lower
+        // than the root, decreases until it reaches the floor of the root
+        inline uint128 rootFloor(uint128 v, unsigned n)
+        {
+            if ((n == 1) || (v < 2)) {
+                return v;
+            } // end if
+            long double const estimate {std::pow(static_cast<long double>(v), 1.0L / n)};
+            uint128 x {static_cast<uint128>(estimate * (1.0L + 1e-12L)) + 2};
+            uint128 power {0};
+            while (powWide(x, n, power) && (power <= v)) {
+                x *= 2;
+            } // end while
+            while (true) {
+                // y = ((n-1)*x + v/x^(n-1))/n (v/x^(n-1) is 0 when x^(n-1) > v)
+                uint128 const quotient {powWide(x, n - 1, power) ? (v / power) : 0};
+                uint128 const y {(((n - 1) * x) + quotient) / n};
+                if (y >= x) {
+                    return x;
+                } // end if
+                x = y;
+            } // end while
+        }
+    } // end namespace detail
+
+    /// \fn    nth_root_approx
+    /// \brief return a Fraction r with |r - f^(1/n)| <= eps (the simplest one found on the
+    ///        grid), or the exact root when the numerator and the denominator of f are
+    ///        perfect nth powers.
+    ///        The grid R/D is bounded by the 128 bits integers (p*D^n shall fit) and by T:
+    ///        when eps is smaller (or not positive), the error is lower than 1/D.
+    ///        NaN for n < 1, for NaN, and for a negative f with an even n. The root of
+    ///        +/-Inf is +/-Inf.
+    /// \param the Fraction, the degree of the root, and the maximal error
+    template<typename T>
+    Fraction<T> nth_root_approx(Fraction<T> const& f, int n, Fraction<T> const& eps)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        bool const negative {f.num() < 0};
+        if ((n < 1) || f.isNan() || (negative && ((n % 2) == 0))) {
+            return Fraction<T>::from_reduced(0, 0);
+        } else if (f.isInf()) {
+            return Fraction<T>::from_reduced(static_cast<T>(negative ? -1 : 1), 0);
+        } else if ((f.num() == 0) || (n == 1)) {
+            return f;
+        } // end if
+        unsigned const degree {static_cast<unsigned>(n)};
+        std::uint64_t const p {detail::magnitude(f.num())};
+        std::uint64_t const q {detail::magnitude(f.den())};
+        T const sign {static_cast<T>(negative ? -1 : 1)};
+        // perfect powers: exact root
+        detail::uint128 const a {detail::rootFloor(p, degree)};
+        detail::uint128 const b {detail::rootFloor(q, degree)};
+        detail::uint128 power {0};
+        if (detail::powWide(a, degree, power) && (power == p) && detail::powWide(b, degree, power) && (power == q)) {
+            return Fraction<T>::from_reduced(static_cast<T>(sign * static_cast<T>(a)), static_cast<T>(b));
+        } // end if
+        // denominator of the grid: 1/eps, as long as p*D^n fits in 128 bits, and the
+        // numerators (about 2*root*D) fit in T
+        std::uint64_t const maxNum {static_cast<std::uint64_t>(std::numeric_limits<T>::max())};
+        int const bits {(127 - detail::bitLength(p)) / n};
+        std::uint64_t den {(bits >= 63) ? (std::uint64_t{1} << 63) : (std::uint64_t{1} << bits)};
+        double const root {std::pow(static_cast<double>(p) / static_cast<double>(q), 1.0 / n)};
+        double const byNum {static_cast<double>(maxNum) / ((2.0 * root) + 3.0)};
+        if (byNum < static_cast<double>(den)) {
+            den = (byNum < 1.0) ? 1 : static_cast<std::uint64_t>(byNum);
+        } // end if
+        if (eps.num() > 0) {
+            std::uint64_t const e {detail::magnitude(eps.num())};
+            std::uint64_t const needed {(eps.isInf() ? 1 : ((detail::magnitude(eps.den()) + e - 1) / e))};
+            den = (needed < den) ? needed : den;
+        } // end if
+        // R = floor(root(p*D^n/q)) = floor(root(floor(p*D^n/q))), so R/D <= root < (R+1)/D
+        detail::uint128 scaled {0};
+        detail::powWide(den, degree, scaled);
+        std::uint64_t const r {static_cast<std::uint64_t>(detail::rootFloor((scaled * p) / q, degree))};
+        // [(R+1-k)/D, (R+k)/D], with k = floor(eps*D) (at least 1), is in [root-eps, root+eps]
+        std::uint64_t k {1};
+        if (eps.num() > 0) {
+            detail::uint128 const product {(static_cast<detail::uint128>(detail::magnitude(eps.num())) * den)};
+            detail::uint128 const steps {eps.isInf() ? product : (product / detail::magnitude(eps.den()))};
+            k = (steps > r) ? (r + 1) : ((steps < 1) ? 1 : static_cast<std::uint64_t>(steps));
+        } // end if
+        if (k > r) {
+            // the interval holds 0
+            return Fraction<T> {0};
+        } // end if
+        std::uint64_t num {0}, q2 {1};
+        detail::simplestBetween(r + 1 - k, den, r + k, den, num, q2);
+        if ((num > maxNum) || (q2 > maxNum)) {
+            return Fraction<T>::from_reduced(0, 0);
+        } // end if
+        // the Fractions of the Stern-Brocot tree are reduced
+        return Fraction<T>::from_reduced(static_cast<T>(sign * static_cast<T>(num)), static_cast<T>(q2));
+    }
+
+    /// \fn    sqrt_approx
+    /// \brief return a Fraction r with |r - sqrt(f)| <= eps (see nth_root_approx)
+    /// \param the Fraction, and the maximal error
+    template<typename T>
+    Fraction<T> sqrt_approx(Fraction<T> const& f, Fraction<T> const& eps)
+    {
+        return nth_root_approx(f, 2, eps);
+    }
+
+} //end namespace
+#endif // FRACTION_ROOT_HPP_INCLUDED
@@ -0,0 +1,242 @@
+#ifndef FRACTION_SERIAL_HPP_INCLUDED
+#define FRACTION_SERIAL_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "Fraction.hpp"
+
+///  \file   FractionSerial.hpp
+///  \brief  Compact binary encoding of Fraction values (and of Fraction streams).
+///          Each Fraction is written as:
+///            - a header varint: bit 0 is set when a denominator follows,
+///              the other bits are the zigzag encoded numerator,
+///            - a varint denominator (only when the header bit 0 is set).
+///          An integer (denominator 1) has no denominator field, so small
+///          integers take 1 byte and small fractions 2 bytes.
+///          NaN and Inf use the denominator 0: NaN is "0/0" (bytes 0x01 0x00),
+///          Inf keeps only the sign of its numerator ("+1/0" or "-1/0").
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace serial {
+
+        /// \var   maxEncodedSize
+        /// \brief maximal number of bytes used to encode one Fraction<T>
+        ///        (header: 65 bits in 7 bits groups, denominator: 64 bits in 7 bits groups)
+        template<typename T>
+        constexpr std::size_t maxEncodedSize()
+        {
+            return ((std::numeric_limits<T>::digits + 2 + 6) / 7) + ((std::numeric_limits<T>::digits + 6) / 7);
+        }
+
+        namespace detail {
+            // zigzag: 0, -1, 1, -2, 2 ... are mapped on 0, 1, 2, 3, 4 ...
+            template<typename T>
+            std::uint64_t zigzag(T v)
+            {
+                std::int64_t const s {static_cast<std::int64_t>(v)};
+                return ((static_cast<std::uint64_t>(s) << 1) ^ static_cast<std::uint64_t>(s >> 63));
+            }
+
+            inline std::int64_t unzigzag(std::uint64_t u)
+            {
+                return static_cast<std::int64_t>((u >> 1) ^ (~(u & 1) + 1));
+            }
+
+            // write a standard (7 bits per byte, little endian) varint, return the number of bytes
+            inline std::size_t putVarint(std::uint64_t v, std::uint8_t* dst)
+            {
+                std::size_t n {0};
+                while (v >= 0x80) {
+                    dst[n++] = static_cast<std::uint8_t>(v | 0x80);
+                    v >>= 7;
+                } // end while
+                dst[n++] = static_cast<std::uint8_t>(v);
+                return n;
+            }
+
+            // read a standard varint, return the number of bytes (0 if truncated or too long)
+            inline std::size_t getVarint(std::uint8_t const* src, std::uint8_t const* end, std::uint64_t& v)
+            {
+                if ((src < end) && (*src < 0x80)) {
+                    v = *src;
+                    return 1;
+                } // end if
+                v = 0;
+                unsigned shift {0};
+                std::uint8_t const* p {src};
+                while ((p < end) && (shift < 64)) {
+                    std::uint8_t const b {*p++};
+                    if ((shift == 63) && (b > 1)) {
+                        // the 10th byte holds only the bit 63
+                        return 0;
+                    } // end if
+                    v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+                    if (b < 0x80) {
+                        return static_cast<std::size_t>(p - src);
+                    } // end if
+                    shift += 7;
+                } // end while
+                return 0;
+            }
+
+            // greatest common divisor (gcd(a, 0) = a)
+            inline std::uint64_t gcd(std::uint64_t a, std::uint64_t b)
+            {
+                while (b != 0) {
+                    std::uint64_t const r {a % b};
+                    a = b;
+                    b = r;
+                } // end while
+                return a;
+            }
+        } // end namespace detail
+
+        /// \fn    encode
+        /// \brief Encode one Fraction
+        /// \param the Fraction to be encoded
+        /// \param destination buffer (at least maxEncodedSize<T>() bytes)
+        /// \return number of bytes written
+        template<typename T>
+        std::size_t encode(Fraction<T> const& f, std::uint8_t* dst)
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+            T num {f.num()};
+            T const den {f.den()};
+            if ((den == 0) && (num != 0)) {
+                num = (num > 0) ? 1 : -1;
+            } // end if
+            std::uint64_t const zz {detail::zigzag(num)};
+            std::uint8_t const flag {static_cast<std::uint8_t>(den != 1)};
+            std::size_t n {0};
+            if (zz < 0x40) {
+                // fast path: the header fits in one byte
+                dst[n++] = static_cast<std::uint8_t>((zz << 1) | flag);
+            } else {
+                dst[n++] = static_cast<std::uint8_t>(0x80 | ((zz & 0x3F) << 1) | flag);
+                n += detail::putVarint(zz >> 6, dst + n);
+            } // end if
+            if (flag) {
+                if (static_cast<std::uint64_t>(den) < 0x80) {
+                    dst[n++] = static_cast<std::uint8_t>(den);
+                } else {
+                    n += detail::putVarint(static_cast<std::uint64_t>(den), dst + n);
+                } // end if
+            } // end if
+            return n;
+        }
+
+        /// \fn    decode
+        /// \brief Decode one Fraction
+        ///        (a Fraction which is not reduced, as 2/4, is malformed)
+        /// \param source buffer and end of the source buffer
+        /// \param the decoded Fraction
+        /// \return number of bytes read (0 if the buffer is truncated or malformed)
+        template<typename T>
+        std::size_t decode(std::uint8_t const* src, std::uint8_t const* end, Fraction<T>& f)
+        {
+            static_assert(std::is_signed<T>::value, "Signed integer required.");
+            if (src >= end) {
+                return 0;
+            } // end if
+            std::uint8_t const h {*src};
+            std::uint64_t zz {static_cast<std::uint64_t>((h >> 1) & 0x3F)};
+            std::size_t n {1};
+            if (h & 0x80) {
+                std::uint64_t high {0};
+                std::size_t const k {detail::getVarint(src + n, end, high)};
+                if ((k == 0) || (high > (std::numeric_limits<std::uint64_t>::max() >> 6))) {
+                    return 0;
+                } // end if
+                zz |= high << 6;
+                n += k;
+            } // end if
+            std::int64_t const num {detail::unzigzag(zz)};
+            if ((num > static_cast<std::int64_t>(std::numeric_limits<T>::max())) ||
+                (num < static_cast<std::int64_t>(std::numeric_limits<T>::min()))) {
+                return 0;
+            } // end if
+            if ((h & 1) == 0) {
+                // an integer is reduced
+                f = Fraction<T>::from_reduced(static_cast<T>(num), T(1));
+                return n;
+            } // end if
+            std::uint64_t den {0};
+            std::size_t const k {detail::getVarint(src + n, end, den)};
+            if ((k == 0) || (den > static_cast<std::uint64_t>(std::numeric_limits<T>::max()))) {
+                return 0;
+            } // end if
+            n += k;
+            if ((den == 0) && ((num < -1) || (num > 1))) {
+                return 0;
+            } // end if
+            std::uint64_t const magnitude {(num < 0) ? (std::uint64_t{0} - static_cast<std::uint64_t>(num)) : static_cast<std::uint64_t>(num)};
+            if ((den != 0) && (detail::gcd(magnitude, den) != 1)) {
+                return 0;
+            } // end if
+            f = Fraction<T>::from_reduced(static_cast<T>(num), static_cast<T>(den));
+            return n;
+        }
+
+        /// \fn    encode
+        /// \brief Encode a stream of Fractions
+        /// \param the Fractions to be encoded, and their number
+        /// \param destination buffer (at least count*maxEncodedSize<T>() bytes)
+        /// \return number of bytes written
+        template<typename T>
+        std::size_t encode(Fraction<T> const* src, std::size_t count, std::uint8_t* dst)
+        {
+            std::uint8_t* p {dst};
+            for (std::size_t i {0}; i < count; ++i) {
+                T const num {src[i].num()};
+                T const den {src[i].den()};
+                // fast path: small integer, or small numerator and denominator
+                if ((num >= -32) && (num < 32)) {
+                    std::uint8_t const zz {static_cast<std::uint8_t>(detail::zigzag(num))};
+                    if (den == 1) {
+                        *p++ = static_cast<std::uint8_t>(zz << 1);
+                        continue;
+                    } else if ((den > 0) && (den < 0x80)) {
+                        p[0] = static_cast<std::uint8_t>((zz << 1) | 1);
+                        p[1] = static_cast<std::uint8_t>(den);
+                        p += 2;
+                        continue;
+                    } // end if
+                } // end if
+                p += encode(src[i], p);
+            } // end for
+            return static_cast<std::size_t>(p - dst);
+        }
+
+        /// \fn    decode
+        /// \brief Decode a stream of Fractions
+        /// \param source buffer and its size (in bytes)
+        /// \param destination of the decoded Fractions, and their number
+        /// \return number of bytes read (0 if the buffer is truncated or malformed)
+        template<typename T>
+        std::size_t decode(std::uint8_t const* src, std::size_t size, Fraction<T>* dst, std::size_t count)
+        {
+            std::uint8_t const* p {src};
+            std::uint8_t const* const end {src + size};
+            for (std::size_t i {0}; i < count; ++i) {
+                // fast path: one byte integer
+                if ((p < end) && ((*p & 0x81) == 0)) {
+                    dst[i] = Fraction<T> {static_cast<T>(detail::unzigzag(*p >> 1))};
+                    ++p;
+                    continue;
+                } // end if
+                std::size_t const n {decode(p, end, dst[i])};
+                if (n == 0) {
+                    return 0;
+                } // end if
+                p += n;
+            } // end for
+            return static_cast<std::size_t>(p - src);
+        }
+
+    } // end namespace serial
+} //end namespace
+#endif // FRACTION_SERIAL_HPP_INCLUDED
@@ -0,0 +1,98 @@
+#ifndef FRACTION_SERIES_HPP_INCLUDED
+#define FRACTION_SERIES_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include "BigInt.hpp"
+#include "Fraction.hpp"
+
+///  \file   FractionSeries.hpp
+///  \brief  Exact sums of rational series by binary splitting.
+///          The term k of the series is given by a generator, as
+///            a(k)/b(k) * p(begin)*...*p(k) / (q(begin)*...*q(k))
+///          (hypergeometric series: exp, arctan..., and harmonic numbers with p = q = 1).
+///          The range of k is split in two halves, recursively, and each half gives 4
+///          integers (products P of p, Q of q, B of b, and a numerator T), combined as
+///            P = P1*P2, Q = Q1*Q2, B = B1*B2, T = B2*Q2*T1 + B1*P1*T2
+///          so the sum T/(B*Q) is computed with products of numbers of similar sizes
+///          (Karatsuba's products of BigInt), instead of a sum of growing Fractions.
+///          The halves of the first levels are computed by different threads.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    /// \struct SeriesTerm
+    /// \brief  term k of a series: a/b times the ratio p/q to the previous term
+    ///         (b and q shall be not null)
+    struct SeriesTerm {
+        std::int64_t m_a;
+        std::int64_t m_b;
+        std::int64_t m_p;
+        std::int64_t m_q;
+    };
+
+    namespace detail {
+        // products of a range of terms, and numerator of their sum
+        struct SeriesSplit {
+            BigInt m_p;
+            BigInt m_q;
+            BigInt m_b;
+            BigInt m_t;
+        };
+
+        // ranges shorter than this are not split between threads
+        std::int64_t const seriesParallelTerms {256};
+
+        template<typename Generator>
+        void binarySplit(Generator const& term, std::int64_t begin, std::int64_t end, unsigned threads, SeriesSplit& r)
+        {
+            if ((end - begin) == 1) {
+                SeriesTerm const t (term(begin));
+                r.m_p = t.m_p;
+                r.m_q = t.m_q;
+                r.m_b = t.m_b;
+                r.m_t = BigInt {t.m_a} * t.m_p;
+                return;
+            } // end if
+            std::int64_t const middle {begin + ((end - begin) / 2)};
+            SeriesSplit left {}, right {};
+            if ((threads > 1) && ((end - begin) >= seriesParallelTerms)) {
+                std::thread worker {[&term, begin, middle, threads, &left]() {
+                    binarySplit(term, begin, middle, threads / 2, left);
+                }};
+                binarySplit(term, middle, end, threads - (threads / 2), right);
+                worker.join();
+            } else {
+                binarySplit(term, begin, middle, 1, left);
+                binarySplit(term, middle, end, 1, right);
+            } // end if
+            r.m_t = (right.m_b * right.m_q * left.m_t) + (left.m_b * left.m_p * right.m_t);
+            r.m_p = left.m_p * right.m_p;
+            r.m_q = left.m_q * right.m_q;
+            r.m_b = left.m_b * right.m_b;
+        }
+    } // end namespace detail
+
+    /// \fn    binary_splitting
+    /// \brief return the exact (reduced) sum of the terms k of a series, for begin <= k < end
+    /// \param the generator of the terms: SeriesTerm term(std::int64_t k) (it is called by
+    ///        several threads at once)
+    /// \param the range of k
+    /// \param the number of threads (0: the number of cores)
+    template<typename Generator>
+    Fraction<BigInt> binary_splitting(Generator term, std::int64_t begin, std::int64_t end, unsigned threads=0)
+    {
+        if (end <= begin) {
+            return Fraction<BigInt> {};
+        } // end if
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        } // end if
+        detail::SeriesSplit r {};
+        detail::binarySplit(term, begin, end, threads, r);
+        return Fraction<BigInt> {r.m_t, r.m_b * r.m_q};
+    }
+
+} //end namespace
+#endif // FRACTION_SERIES_HPP_INCLUDED
@@ -0,0 +1,182 @@
+#ifndef FRACTION_SORT_HPP_INCLUDED
+#define FRACTION_SORT_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <thread>
+#include <vector>
+#include "Fraction.hpp"
+#include "FractionConvert.hpp"
+
+///  \file   FractionSort.hpp
+///  \brief  Parallel sort of Fractions.
+///          Each Fraction gets a 64 bits key, built from its (correctly rounded, so
+///          monotone) double value. The keys are sorted by a parallel LSD radix sort
+///          (8 bits per pass, the passes where all the keys have the same digit are
+///          skipped), then the Fractions which share a key are sorted exactly with
+///          the Fraction comparison.
+///          The order is the one of operator< ; NaN (which can not be compared) are
+///          put at the end.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // key and position of a Fraction
+        struct SortItem {
+            std::uint64_t m_key;
+            std::size_t m_index;
+        };
+
+        // key with the same order as the double (NaN after all the values)
+        template<typename T>
+        std::uint64_t sortKey(Fraction<T> const& f)
+        {
+            if (f.isNan()) {
+                return ~std::uint64_t{0};
+            } // end if
+            double const d {to_double(f)};
+            std::uint64_t bits {0};
+            std::memcpy(&bits, &d, sizeof(bits));
+            // negative values: all the bits are inverted, positive values: the sign bit is set
+            return ((bits >> 63) != 0) ? ~bits : (bits | (std::uint64_t{1} << 63));
+        }
+
+        // call job(begin, end, thread) on "threads" slices of [0, count[
+        template<typename Job>
+        void parallelFor(std::size_t count, unsigned threads, Job job)
+        {
+            if (threads <= 1) {
+                job(std::size_t{0}, count, 0u);
+                return;
+            } // end if
+            std::vector<std::thread> pool;
+            for (unsigned t {0}; t < threads; ++t) {
+                std::size_t const begin {(count * t) / threads};
+                std::size_t const end {(count * (t + 1)) / threads};
+                pool.emplace_back(job, begin, end, t);
+            } // end for
+            for (std::thread& thread : pool) {
+                thread.join();
+            } // end for
+        }
+
+        template<typename RandomIt>
+        void fractionSort(RandomIt first, RandomIt last, unsigned threads, bool stable)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type Value;
+            std::size_t const count {static_cast<std::size_t>(last - first)};
+            auto const less = [](Value const& f1, Value const& f2) {return (f1 < f2);};
+            if (count < 1024) {
+                // small range: the radix sort does not pay
+                RandomIt const end {stable ? std::stable_partition(first, last, [](Value const& f) {return !f.isNan();})
+                                           : std::partition(first, last, [](Value const& f) {return !f.isNan();})};
+                if (stable) {
+                    std::stable_sort(first, end, less);
+                } else {
+                    std::sort(first, end, less);
+                } // end if
+                return;
+            } // end if
+            if (threads == 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            } // end if
+            threads = static_cast<unsigned>(std::min<std::size_t>(threads, count / 1024));
+            threads = std::max(1u, threads);
+            std::vector<SortItem> items (count);
+            std::vector<SortItem> buffer (count);
+            parallelFor(count, threads, [&](std::size_t begin, std::size_t end, unsigned) {
+                for (std::size_t i {begin}; i < end; ++i) {
+                    items[i].m_key = sortKey(first[i]);
+                    items[i].m_index = i;
+                } // end for
+            });
+            // radix sort of the keys (stable)
+            std::vector<std::size_t> counts (static_cast<std::size_t>(threads) * 256);
+            for (unsigned shift {0}; shift < 64; shift += 8) {
+                std::fill(counts.begin(), counts.end(), 0);
+                parallelFor(count, threads, [&](std::size_t begin, std::size_t end, unsigned t) {
+                    std::size_t* const c {&counts[t * 256]};
+                    for (std::size_t i {begin}; i < end; ++i) {
+                        ++c[(items[i].m_key >> shift) & 0xFF];
+                    } // end for
+                });
+                // offsets of each (digit, thread), and check if all the keys have the same digit
+                std::size_t offset {0};
+                bool uniform {false};
+                for (std::size_t digit {0}; digit < 256; ++digit) {
+                    std::size_t total {0};
+                    for (unsigned t {0}; t < threads; ++t) {
+                        std::size_t const c {counts[(t * 256) + digit]};
+                        counts[(t * 256) + digit] = offset;
+                        offset += c;
+                        total += c;
+                    } // end for
+                    uniform |= (total == count);
+                } // end for
+                if (uniform) {
+                    continue;
+                } // end if
+                parallelFor(count, threads, [&](std::size_t begin, std::size_t end, unsigned t) {
+                    std::size_t* const c {&counts[t * 256]};
+                    for (std::size_t i {begin}; i < end; ++i) {
+                        buffer[c[(items[i].m_key >> shift) & 0xFF]++] = items[i];
+                    } // end for
+                });
+                items.swap(buffer);
+            } // end for
+            buffer = std::vector<SortItem> {};
+            // permutation of the Fractions
+            std::vector<Value> values (count);
+            parallelFor(count, threads, [&](std::size_t begin, std::size_t end, unsigned) {
+                for (std::size_t i {begin}; i < end; ++i) {
+                    values[i] = first[items[i].m_index];
+                } // end for
+            });
+            parallelFor(count, threads, [&](std::size_t begin, std::size_t end, unsigned) {
+                std::copy(values.begin() + begin, values.begin() + end, first + begin);
+            });
+            // exact sort of the Fractions with the same key (except NaN)
+            std::size_t begin {0};
+            while (begin < count) {
+                std::size_t end {begin + 1};
+                while ((end < count) && (items[end].m_key == items[begin].m_key)) {
+                    ++end;
+                } // end while
+                if ((end - begin > 1) && (items[begin].m_key != ~std::uint64_t{0})) {
+                    if (stable) {
+                        std::stable_sort(first + begin, first + end, less);
+                    } else {
+                        std::sort(first + begin, first + end, less);
+                    } // end if
+                } // end if
+                begin = end;
+            } // end while
+        }
+    } // end namespace detail
+
+    /// \fn    sort
+    /// \brief Parallel sort of a range of Fractions (NaN are put at the end)
+    /// \param the range (random access iterators)
+    /// \param number of threads (0: number of cores)
+    template<typename RandomIt>
+    void sort(RandomIt first, RandomIt last, unsigned threads = 0)
+    {
+        detail::fractionSort(first, last, threads, false);
+    }
+
+    /// \fn    stable_sort
+    /// \brief Parallel stable sort of a range of Fractions (NaN are put at the end)
+    /// \param the range (random access iterators)
+    /// \param number of threads (0: number of cores)
+    template<typename RandomIt>
+    void stable_sort(RandomIt first, RandomIt last, unsigned threads = 0)
+    {
+        detail::fractionSort(first, last, threads, true);
+    }
+
+} //end namespace
+#endif // FRACTION_SORT_HPP_INCLUDED
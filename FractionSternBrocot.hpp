@@ -0,0 +1,187 @@
+#ifndef FRACTION_STERN_BROCOT_HPP_INCLUDED
+#define FRACTION_STERN_BROCOT_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "Fraction.hpp"
+
+///  \file   FractionSternBrocot.hpp
+///  \brief  Searches in the Stern-Brocot tree:
+///            - simplest Fraction (smallest denominator) of an interval,
+///            - binary search of the limit of a monotone predicate.
+///          Both descend the tree by runs (the partial quotients of the
+///          continued fractions), so the number of steps is logarithmic.
+///  \author Dedeun
+///  \date   16 oct 2026
+
+namespace dd {
+    namespace detail {
+        // simplest fraction p/q of [a/b, c/d], with 0 < a/b <= c/d (b and d not null):
+        // while the interval has no integer, its common integer part is a partial
+        // quotient of the result, and the search continues on the inverted
+        // fractional parts [d/(c mod d), b/(a mod b)]
+        inline void simplestBetween(std::uint64_t a, std::uint64_t b, std::uint64_t c, std::uint64_t d,
+                                    std::uint64_t& p, std::uint64_t& q)
+        {
+            // h1/k1 and h0/k0: the two last convergents of the partial quotients already found
+            std::uint64_t h0 {0}, k0 {1}, h1 {1}, k1 {0};
+            while (true) {
+                std::uint64_t const t {a / b};
+                std::uint64_t const ra {a % b};
+                if ((ra == 0) || ((c / d) > t)) {
+                    // the interval holds an integer: t (if a/b is an integer) or t+1
+                    std::uint64_t const term {(ra == 0) ? t : (t + 1)};
+                    p = (term * h1) + h0;
+                    q = (term * k1) + k0;
+                    return;
+                } // end if
+                std::uint64_t const h2 {(t * h1) + h0};
+                std::uint64_t const k2 {(t * k1) + k0};
+                h0 = h1;
+                k0 = k1;
+                h1 = h2;
+                k1 = k2;
+                std::uint64_t const rc {c % d};
+                std::uint64_t const oldB {b};
+                a = d;
+                b = rc;
+                c = oldB;
+                d = ra;
+            } // end while
+        }
+
+        // largest k such that test(k) holds, with 0 <= k <= kmax and test(0) true (test decreasing):
+        // exponential search, then binary search
+        template<typename Test>
+        std::uint64_t longestRun(std::uint64_t kmax, Test test)
+        {
+            std::uint64_t good {0};
+            std::uint64_t step {1};
+            while ((step <= kmax - good) && test(good + step)) {
+                good += step;
+                step *= 2;
+            } // end while
+            std::uint64_t bad {(step <= kmax - good) ? (good + step) : (kmax + 1)};
+            while (bad - good > 1) {
+                std::uint64_t const mid {good + ((bad - good) / 2)};
+                if (test(mid)) {
+                    good = mid;
+                } else {
+                    bad = mid;
+                } // end if
+            } // end while
+            return good;
+        }
+
+        // Inf with a positive numerator
+        template<typename T>
+        Fraction<T> positiveInf()
+        {
+            return Fraction<T>::from_reduced(1, 0);
+        }
+    } // end namespace detail
+
+    /// \fn    simplest_between
+    /// \brief return the simplest Fraction (smallest denominator, then smallest numerator
+    ///        magnitude) of the interval [lo, hi]
+    ///        An infinite bound (Inf) means no bound. NaN is returned when lo > hi, or
+    ///        when lo or hi is NaN.
+    /// \param the bounds of the interval
+    template<typename T>
+    Fraction<T> simplest_between(Fraction<T> const& lo, Fraction<T> const& hi)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        if (lo.isNan() || hi.isNan() || (lo > hi)) {
+            return Fraction<T> {0, 0};
+        } else if ((lo.num() <= 0) && (hi.num() >= 0)) {
+            return Fraction<T> {0};
+        } else if (hi.num() < 0) {
+            Fraction<T> const f {simplest_between(Fraction<T> {0} - hi, Fraction<T> {0} - lo)};
+            return Fraction<T> {0} - f;
+        } else if (lo.isInf()) {
+            // [+Inf, +Inf]
+            return lo;
+        } else if (hi.isInf()) {
+            // [lo, +Inf]: the smallest integer not lower than lo
+            T const t {static_cast<T>(lo.num() / lo.den())};
+            return Fraction<T> {static_cast<T>(((lo.num() % lo.den()) == 0) ? t : (t + 1))};
+        } // end if
+        std::uint64_t p {0}, q {1};
+        detail::simplestBetween(static_cast<std::uint64_t>(lo.num()), static_cast<std::uint64_t>(lo.den()),
+                                static_cast<std::uint64_t>(hi.num()), static_cast<std::uint64_t>(hi.den()), p, q);
+        return Fraction<T>::from_reduced(static_cast<T>(p), static_cast<T>(q));
+    }
+
+    /// \fn    simplest_between
+    /// \brief simplest Fraction of each interval [lo[i], hi[i]] (see simplest_between)
+    /// \param the bounds of the intervals, and their number
+    /// \param destination array
+    template<typename T>
+    void simplest_between(Fraction<T> const* lo, Fraction<T> const* hi, std::size_t count, Fraction<T>* out)
+    {
+        for (std::size_t i {0}; i < count; ++i) {
+            out[i] = simplest_between(lo[i], hi[i]);
+        } // end for
+    }
+
+    /// \fn    stern_brocot_search
+    /// \brief Binary search, on the non negative Fractions with a denominator not greater than
+    ///        maxDen, of the limit of a monotone predicate (false, then true, when the value
+    ///        increases, as "x*x >= 2" or "x > 0.3").
+    ///        The tree is descended by runs, each run being found by an exponential search
+    ///        then a binary search: the predicate is called O(log(maxDen)^2) times.
+    /// \param the predicate (called with a Fraction<T>)
+    /// \param the maximal denominator (at least 1)
+    /// \return the greatest Fraction where the predicate is false (NaN if it is true at 0),
+    ///         and the smallest one where it is true (Inf if it is always false)
+    template<typename T, typename Predicate>
+    std::pair<Fraction<T>, Fraction<T>> stern_brocot_search(Predicate pred, T maxDen)
+    {
+        static_assert(std::is_signed<T>::value, "Signed integer required.");
+        if (pred(Fraction<T> {0})) {
+            return std::make_pair(Fraction<T> {0, 0}, Fraction<T> {0});
+        } // end if
+        std::uint64_t const maxNum {static_cast<std::uint64_t>(std::numeric_limits<T>::max())};
+        std::uint64_t const maxQ {static_cast<std::uint64_t>(std::max(maxDen, T(1)))};
+        // the limit is in ]lp/lq, rp/rq], lp/lq and rp/rq being adjacent in the tree
+        std::uint64_t lp {0}, lq {1}, rp {1}, rq {0};
+        // number of steps allowed by the bounds from (p, q) in the direction (dp, dq)
+        auto const limit = [maxNum, maxQ](std::uint64_t p, std::uint64_t q, std::uint64_t dp, std::uint64_t dq) -> std::uint64_t {
+            std::uint64_t k {std::numeric_limits<std::uint64_t>::max()};
+            if (dp != 0) {
+                k = (maxNum - p) / dp;
+            } // end if
+            if (dq != 0) {
+                k = std::min(k, (maxQ - q) / dq);
+            } // end if
+            return k;
+        };
+        while (true) {
+            // to the right: the predicate stays false on (lp + k*rp)/(lq + k*rq)
+            std::uint64_t const right {detail::longestRun(limit(lp, lq, rp, rq), [&](std::uint64_t k) {
+                return !pred(Fraction<T>::from_reduced(static_cast<T>(lp + (k * rp)), static_cast<T>(lq + (k * rq))));
+            })};
+            lp += right * rp;
+            lq += right * rq;
+            // to the left: the predicate stays true on (rp + k*lp)/(rq + k*lq)
+            std::uint64_t const left {detail::longestRun(limit(rp, rq, lp, lq), [&](std::uint64_t k) {
+                return pred(Fraction<T>::from_reduced(static_cast<T>(rp + (k * lp)), static_cast<T>(rq + (k * lq))));
+            })};
+            rp += left * lp;
+            rq += left * lq;
+            if (left == 0) {
+                // the next mediant is out of the bounds (it is neither true nor false)
+                break;
+            } // end if
+        } // end while
+        // the fractions of the Stern-Brocot tree are reduced
+        Fraction<T> const lower {Fraction<T>::from_reduced(static_cast<T>(lp), static_cast<T>(lq))};
+        return std::make_pair(lower, (rq == 0) ? detail::positiveInf<T>() : Fraction<T>::from_reduced(static_cast<T>(rp), static_cast<T>(rq)));
+    }
+
+} //end namespace
+#endif // FRACTION_STERN_BROCOT_HPP_INCLUDED
@@ -0,0 +1,359 @@
+#ifndef LAZY_FRACTION_HPP_INCLUDED
+#define LAZY_FRACTION_HPP_INCLUDED
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Fraction.hpp"
+#include "FractionConvert.hpp"
+
+///  \file   LazyFraction.hpp
+///  \brief  Lazy exact number, on top of Fraction ("lazy exact" number type):
+///          each value carries an interval of double (rounded outward) and the
+///          expression (a DAG) which gives its exact Fraction. The comparisons are
+///          decided by the intervals when they do not overlap, and the exact
+///          Fractions are computed only when the intervals are too wide to decide.
+///          (the DAG is shared between the values, it shall not be used by
+///          several threads at once)
+///  \author Dedeun
+///  \date   16 oct 2026
+
+///  \class LazyFraction
+///  \brief Lazy exact number, with the 4 operations (+, -, *, /)
+///         and comparison (>, >=, <, <=, ==, and !=)
+namespace dd {
+    template<typename T>
+    class LazyFraction final {
+    public:
+        /// \fn    LazyFraction ();
+        /// \brief Constructor (from an integer)
+        /// \param the value
+        LazyFraction (T num=0): LazyFraction{Fraction<T> {num}}
+        {
+        }
+
+        /// \fn    LazyFraction ();
+        /// \brief Constructor (from a Fraction)
+        /// \param the exact value
+        LazyFraction (Fraction<T> const& f): m_node{std::make_shared<Node>(f)}
+        {
+            setInterval(f);
+        }
+
+        /// \fn    lower
+        /// \brief return the lower bound of the interval
+        double lower() const
+        {
+            return m_lo;
+        }
+        /// \fn    upper
+        /// \brief return the upper bound of the interval
+        double upper() const
+        {
+            return m_hi;
+        }
+
+        /// \fn    exact
+        /// \brief return the exact value (computed, if needed, from the DAG)
+        Fraction<T> const& exact() const
+        {
+            if (!m_node->m_evaluated) {
+                evaluate(m_node.get());
+            } // end if
+            return m_node->m_value;
+        }
+
+        /// \fn    +=
+        /// \brief Self addition
+        /// \param the LazyFraction to be added
+        LazyFraction<T> operator+= (LazyFraction<T> const& f)
+        {
+            double const lo {down(m_lo + f.m_lo)};
+            double const hi {up(m_hi + f.m_hi)};
+            return assign(Add, f, lo, hi);
+        }
+
+        /// \fn    -=
+        /// \brief Self subtraction
+        /// \param the LazyFraction to be subtract
+        LazyFraction<T> operator-= (LazyFraction<T> const& f)
+        {
+            double const lo {down(m_lo - f.m_hi)};
+            double const hi {up(m_hi - f.m_lo)};
+            return assign(Sub, f, lo, hi);
+        }
+
+        /// \fn    *=
+        /// \brief Self multiplication
+        /// \param the LazyFraction to be multiply
+        LazyFraction<T> operator*= (LazyFraction<T> const& f)
+        {
+            double const p1 {m_lo * f.m_lo};
+            double const p2 {m_lo * f.m_hi};
+            double const p3 {m_hi * f.m_lo};
+            double const p4 {m_hi * f.m_hi};
+            double const lo {down(std::min(std::min(p1, p2), std::min(p3, p4)))};
+            double const hi {up(std::max(std::max(p1, p2), std::max(p3, p4)))};
+            return assign(Mul, f, lo, hi);
+        }
+
+        /// \fn    /=
+        /// \brief Self division
+        /// \param the LazyFraction to be divided
+        LazyFraction<T> operator/= (LazyFraction<T> const& f)
+        {
+            double lo {-std::numeric_limits<double>::infinity()};
+            double hi {std::numeric_limits<double>::infinity()};
+            if ((f.m_lo > 0) || (f.m_hi < 0)) {
+                double const q1 {m_lo / f.m_lo};
+                double const q2 {m_lo / f.m_hi};
+                double const q3 {m_hi / f.m_lo};
+                double const q4 {m_hi / f.m_hi};
+                lo = down(std::min(std::min(q1, q2), std::min(q3, q4)));
+                hi = up(std::max(std::max(q1, q2), std::max(q3, q4)));
+            } // end if
+            return assign(Div, f, lo, hi);
+        }
+
+        /// \fn    <<
+        /// \brief Output on flux (exact value)
+        /// \param reference to the output flux
+        /// \param reference of the LazyFraction
+        friend std::ostream& operator<< (std::ostream& flux, LazyFraction<T> const& f)
+        {
+            return (flux << f.exact());
+        }
+
+        /// \fn    ==
+        /// \brief comparison: is equal to
+        /// \param the LazyFraction to be compared
+        friend bool operator== (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+        {
+            if ((f1.m_lo > f2.m_hi) || (f1.m_hi < f2.m_lo)) {
+                return false;
+            } // end if
+            return (f1.exact() == f2.exact());
+        }
+
+        /// \fn    >
+        /// \brief comparison: is greater than
+        /// \param the LazyFraction to be compared
+        friend bool operator> (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+        {
+            if (f1.m_lo > f2.m_hi) {
+                return true;
+            } else if (f1.m_hi <= f2.m_lo) {
+                return false;
+            } // end if
+            return (f1.exact() > f2.exact());
+        }
+
+    protected:
+    private:
+        enum Operation {Leaf, Add, Sub, Mul, Div};
+
+        // node of the DAG: an operation and its operands, or an exact value
+        struct Node {
+            explicit Node (Fraction<T> const& f): m_op{Leaf}, m_evaluated{true}, m_value{f}
+            {
+            }
+            Node (Operation op, std::shared_ptr<Node> const& left, std::shared_ptr<Node> const& right):
+                m_op{op}, m_evaluated{false}, m_left{left}, m_right{right}
+            {
+            }
+            // the operands are released without recursion (a DAG can be a very long chain)
+            ~Node ()
+            {
+                std::vector<std::shared_ptr<Node>> pending;
+                pending.push_back(std::move(m_left));
+                pending.push_back(std::move(m_right));
+                while (!pending.empty()) {
+                    std::shared_ptr<Node> node {std::move(pending.back())};
+                    pending.pop_back();
+                    if (node && (node.use_count() == 1)) {
+                        pending.push_back(std::move(node->m_left));
+                        pending.push_back(std::move(node->m_right));
+                    } // end if
+                } // end while
+            }
+            Operation m_op;
+            bool m_evaluated;
+            Fraction<T> m_value;
+            std::shared_ptr<Node> m_left;
+            std::shared_ptr<Node> m_right;
+        };
+
+        // rounding toward -infinity and +infinity of a result rounded to nearest
+        static double down(double v)
+        {
+            return std::nextafter(v, -std::numeric_limits<double>::infinity());
+        }
+        static double up(double v)
+        {
+            return std::nextafter(v, std::numeric_limits<double>::infinity());
+        }
+
+        // interval of an exact value (to_double is correctly rounded, and exact for small integers)
+        void setInterval(Fraction<T> const& f)
+        {
+            if (!f.isFinite()) {
+                m_lo = -std::numeric_limits<double>::infinity();
+                m_hi = std::numeric_limits<double>::infinity();
+                return;
+            } // end if
+            double const d {to_double(f)};
+            if ((f.den() == 1) && (std::fabs(d) <= 9007199254740992.0)) {
+                m_lo = d;
+                m_hi = d;
+            } else {
+                m_lo = down(d);
+                m_hi = up(d);
+            } // end if
+        }
+
+        // new DAG node "this op f", with its interval
+        LazyFraction<T> assign(Operation op, LazyFraction<T> const& f, double lo, double hi)
+        {
+            if (std::isnan(lo) || std::isnan(hi)) {
+                // operations on infinite bounds (Inf or NaN operand): nothing is known
+                lo = -std::numeric_limits<double>::infinity();
+                hi = std::numeric_limits<double>::infinity();
+            } // end if
+            m_node = std::make_shared<Node>(op, m_node, f.m_node);
+            m_lo = lo;
+            m_hi = hi;
+            return (*this);
+        }
+
+        // exact value of the node (the DAG is walked without recursion, and each evaluated
+        // node drops its operands, which are no more needed)
+        static void evaluate(Node* root)
+        {
+            std::vector<Node*> stack {root};
+            while (!stack.empty()) {
+                Node* const node {stack.back()};
+                if (node->m_evaluated) {
+                    stack.pop_back();
+                } else if (!node->m_left->m_evaluated) {
+                    stack.push_back(node->m_left.get());
+                } else if (!node->m_right->m_evaluated) {
+                    stack.push_back(node->m_right.get());
+                } else {
+                    Fraction<T> const& a {node->m_left->m_value};
+                    Fraction<T> const& b {node->m_right->m_value};
+                    switch (node->m_op) {
+                    case Add:
+                        node->m_value = a + b;
+                        break;
+                    case Sub:
+                        node->m_value = a - b;
+                        break;
+                    case Mul:
+                        node->m_value = a * b;
+                        break;
+                    default:
+                        node->m_value = a / b;
+                        break;
+                    } // end switch
+                    node->m_evaluated = true;
+                    node->m_op = Leaf;
+                    node->m_left.reset();
+                    node->m_right.reset();
+                    stack.pop_back();
+                } // end if
+            } // end while
+        }
+
+        /// \var   m_lo
+        /// \brief member variable: lower bound of the value
+        double m_lo;
+        /// \var   m_hi
+        /// \brief member variable: upper bound of the value
+        double m_hi;
+        /// \var   m_node
+        /// \brief member variable: DAG node of the exact value
+        std::shared_ptr<Node> m_node;
+    }; // end class
+
+    /// \fn    +
+    /// \brief Addition
+    /// \param the LazyFraction to be added
+    template<typename T>
+    LazyFraction<T> operator+ (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+        LazyFraction<T> f {f1};
+        return (f+=f2);
+    }
+
+    /// \fn    -
+    /// \brief Subtraction
+    /// \param the LazyFraction to be subtract
+    template<typename T>
+    LazyFraction<T> operator- (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+        LazyFraction<T> f {f1};
+        return (f-=f2);
+    }
+
+    /// \fn    *
+    /// \brief Multiplication
+    /// \param the LazyFraction to be multiplied
+    template<typename T>
+    LazyFraction<T> operator* (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+        LazyFraction<T> f {f1};
+        return (f*=f2);
+    }
+
+    /// \fn    /
+    /// \brief Division
+    /// \param the LazyFraction to be divided
+    template<typename T>
+    LazyFraction<T> operator/ (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+        LazyFraction<T> f {f1};
+        return (f/=f2);
+    }
+
+    /// \fn    !=
+    /// \brief comparison: is not equal to
+    /// \param the LazyFraction to be compared
+    template<typename T>
+    bool operator!= (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+       return (!(f1==f2));
+    }
+
+    /// \fn    >=
+    /// \brief comparison: is greater or equal to
+    /// \param the LazyFraction to be compared
+    template<typename T>
+    bool operator>= (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+        return (!(f2>f1));
+    }
+
+    /// \fn    <
+    /// \brief comparison: is smaller than
+    /// \param the LazyFraction to be compared
+    template<typename T>
+    bool operator< (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+        return (f2>f1);
+    }
+
+    /// \fn    <=
+    /// \brief comparison: is smaller or equal to
+    /// \param the LazyFraction to be compared
+    template<typename T>
+    bool operator<= (LazyFraction<T> const& f1, LazyFraction<T> const& f2)
+    {
+        return (!(f1>f2));
+    }
+
+} //end namespace
+#endif // LAZY_FRACTION_HPP_INCLUDED
@@ -0,0 +1,127 @@
+#ifndef PRIME_SIEVE_HPP_INCLUDED
+#define PRIME_SIEVE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///  \file   PrimeSieve.hpp
+///  \brief  Table of the primes up to a limit, and factorization of the integers.
+///          The linear sieve (each composite number is crossed out once, by its
+///          smallest prime factor) stores, for each n <= limit, the index of the
+///          smallest prime factor of n: the factorization of n is then a few table
+///          lookups. The greater integers are divided by the primes of the table
+///          first (trial division).
+///  \author Dedeun
+///  \date   16 oct 2026
+
+///  \class PrimeSieve
+///  \brief Primes up to a limit, with the smallest prime factor of each integer
+namespace dd {
+    class PrimeSieve final {
+    public:
+        /// \var   noIndex
+        /// \brief index of the factors greater than the limit of the table
+        static std::uint32_t const noIndex {0xFFFFFFFF};
+
+        /// \struct PrimePower
+        /// \brief  factor p^e of an integer, with the index of p in the table
+        struct PrimePower {
+            std::uint64_t m_prime;
+            std::uint32_t m_index;
+            unsigned m_exponent;
+        };
+
+        /// \fn    PrimeSieve (std::uint32_t limit);
+        /// \brief Constructor: sieve of the integers up to limit
+        /// \param the limit of the table (for example 2^20: 4 MB)
+        explicit PrimeSieve (std::uint32_t limit): m_smallest(static_cast<std::size_t>(limit) + 1, static_cast<std::uint32_t>(noIndex)), m_primes{}
+        {
+            for (std::uint64_t n {2}; n <= limit; ++n) {
+                if (m_smallest[n] == noIndex) {
+                    m_smallest[n] = static_cast<std::uint32_t>(m_primes.size());
+                    m_primes.push_back(static_cast<std::uint32_t>(n));
+                } // end if
+                // the multiples n*p, for the primes p up to the smallest prime factor of n
+                std::uint32_t const last {m_smallest[n]};
+                for (std::uint32_t i {0}; (i <= last) && ((n * m_primes[i]) <= limit); ++i) {
+                    m_smallest[n * m_primes[i]] = i;
+                } // end for
+            } // end for
+        }
+
+        /// \fn    limit
+        /// \brief return the greatest integer of the table
+        std::uint64_t limit() const
+        {
+            return m_smallest.size() - 1;
+        }
+
+        /// \fn    count
+        /// \brief return the number of primes of the table
+        std::size_t count() const
+        {
+            return m_primes.size();
+        }
+
+        /// \fn    prime
+        /// \brief return the prime of an index (2 for the index 0)
+        /// \param the index (lower than count())
+        std::uint32_t prime(std::size_t index) const
+        {
+            return m_primes[index];
+        }
+
+        /// \fn    factorize
+        /// \brief Factorization of n: its prime powers, by increasing primes. When n is
+        ///        greater than limit^2, the last factor can be a composite number greater
+        ///        than the limit (with noIndex): it is a divisor of n without any prime
+        ///        factor of the table.
+        /// \param the integer (not null)
+        /// \param destination of the factors (cleared first; 1 has no factor)
+        void factorize(std::uint64_t n, std::vector<PrimePower>& factors) const
+        {
+            factors.clear();
+            // trial division, until the rest is in the table
+            for (std::size_t i {0}; (n > limit()) && (i < m_primes.size()); ++i) {
+                std::uint64_t const p {m_primes[i]};
+                if ((p * p) > n) {
+                    break;
+                } else if ((n % p) == 0) {
+                    unsigned e {0};
+                    while ((n % p) == 0) {
+                        n /= p;
+                        ++e;
+                    } // end while
+                    factors.push_back(PrimePower {p, static_cast<std::uint32_t>(i), e});
+                } // end if
+            } // end for
+            if (n > limit()) {
+                factors.push_back(PrimePower {n, noIndex, 1});
+                return;
+            } // end if
+            // lookups of the smallest prime factor
+            while (n > 1) {
+                std::uint32_t const i {m_smallest[n]};
+                std::uint64_t const p {m_primes[i]};
+                unsigned e {0};
+                while ((n % p) == 0) {
+                    n /= p;
+                    ++e;
+                } // end while
+                factors.push_back(PrimePower {p, i, e});
+            } // end while
+        }
+
+    protected:
+    private:
+        /// \var   m_smallest
+        /// \brief member variable: index of the smallest prime factor of each integer
+        std::vector<std::uint32_t> m_smallest;
+        /// \var   m_primes
+        /// \brief member variable: the primes, increasing
+        std::vector<std::uint32_t> m_primes;
+    }; // end class
+
+} //end namespace
+#endif // PRIME_SIEVE_HPP_INCLUDED
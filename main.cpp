@@ -1,6 +1,27 @@
 #include <iostream>
 #include <cstdint>
+#include "BigInt.hpp"
+#include "ContinuedFraction.hpp"
 #include "Fraction.hpp"
+#include "FractionColumn.hpp"
+#include "FractionConvert.hpp"
+#include "FractionDot.hpp"
+#include "FractionExpr.hpp"
+#include "FractionFactored.hpp"
+#include "FractionFilter.hpp"
+#include "FractionHash.hpp"
+#include "FractionKernel.hpp"
+#include "FractionKey.hpp"
+#include "FractionPow.hpp"
+#include "FractionProductTree.hpp"
+#include "FractionProgram.hpp"
+#include "FractionRoot.hpp"
+#include "FractionSeries.hpp"
+#include "FractionSerial.hpp"
+#include "FractionSort.hpp"
+#include "FractionSternBrocot.hpp"
+#include "LazyFraction.hpp"
+#include "PrimeSieve.hpp"
 
 using namespace dd;
 
@@ -27,6 +48,255 @@ void test01 (Fraction<int32_t> const& f1, Fraction<int32_t> const& f2)
     if (f1!=f2) std::cout << f1 << " != " << f2 << std::endl;
 }
 
+void test02 (Fraction<int64_t> const* f, std::size_t count)
+{
+    std::uint8_t buffer [64];
+    std::size_t const size {serial::encode(f, count, buffer)};
+    Fraction<int64_t> g [4];
+    std::size_t const read {serial::decode(buffer, size, g, count)};
+    std::cout << count << " Fractions encoded in " << size << " bytes, " << read << " bytes decoded:";
+    for (std::size_t i {0}; i < count; ++i) {
+        std::cout << " " << g[i];
+    } // end for
+    std::cout << std::endl;
+}
+
+void test03 (Fraction<int64_t> const* f, std::size_t count)
+{
+    FractionColumn<int64_t> const column {f, count};
+    std::cout << count << " Fractions stored in " << column.memoryUsage() << " bytes:";
+    for (std::size_t i {0}; i < column.size(); ++i) {
+        std::cout << " " << column[i];
+    } // end for
+    std::cout << std::endl;
+}
+
+void test04 (Fraction<int64_t> const* f, std::size_t count)
+{
+    double d [4];
+    to_double(f, count, d);
+    for (std::size_t i {0}; i < count; ++i) {
+        std::cout << f[i] << " = " << d[i] << " (float: " << to_float(f[i]) << ")" << std::endl;
+    } // end for
+}
+
+void test05 (double x, int32_t maxDen)
+{
+    std::cout << x << " ~ " << from_double<int32_t>(x, maxDen) << " (denominator <= " << maxDen << ")" << std::endl;
+}
+
+void test06 (Fraction<int32_t> const& lo, Fraction<int32_t> const& hi)
+{
+    std::cout << "simplest Fraction in [" << lo << ", " << hi << "] = " << simplest_between(lo, hi) << std::endl;
+    auto const limit = stern_brocot_search<int32_t>([lo](Fraction<int32_t> const& f) {return f > lo;}, hi.den());
+    std::cout << "closest Fractions around " << lo << " (denominator <= " << hi.den() << "): "
+              << limit.first << " " << limit.second << std::endl;
+}
+
+void test07 (Fraction<int64_t> const& f1, Fraction<int64_t> const& f2)
+{
+    if (f1<f2) std::cout << f1 << " < " << f2 << std::endl;
+    if (f1>f2) std::cout << f1 << " > " << f2 << std::endl;
+    if (f1==f2) std::cout << f1 << " == " << f2 << std::endl;
+    CachedFraction<int64_t> const c1 {f1};
+    CachedFraction<int64_t> const c2 {f2};
+    if ((c1<c2) != (f1<f2)) std::cout << "filtered comparison error" << std::endl;
+    if ((c1>c2) != (f1>f2)) std::cout << "filtered comparison error" << std::endl;
+}
+
+void test08 (LazyFraction<int64_t> const& f1, LazyFraction<int64_t> const& f2)
+{
+    LazyFraction<int64_t> const f {(f1 * f2) - (f1 / f2)};
+    std::cout << "(" << f1 << " * " << f2 << ") - (" << f1 << " / " << f2 << ") is in ["
+              << f.lower() << ", " << f.upper() << "]" << std::endl;
+    if (f < f1) std::cout << f << " < " << f1 << std::endl;
+    if (f == f1) std::cout << f << " == " << f1 << std::endl;
+    if (f > f1) std::cout << f << " > " << f1 << std::endl;
+}
+
+void test09 (Fraction<int64_t> const& f, int64_t n, double x)
+{
+    if (f<n) std::cout << f << " < " << n << std::endl;
+    if (f==n) std::cout << f << " == " << n << std::endl;
+    if (f>n) std::cout << f << " > " << n << std::endl;
+    if (f<x) std::cout << f << " < " << x << std::endl;
+    if (f==x) std::cout << f << " == " << x << std::endl;
+    if (f>x) std::cout << f << " > " << x << std::endl;
+}
+
+void test10 (Fraction<int64_t>* f, std::size_t count)
+{
+    dd::stable_sort(f, f + count);
+    std::cout << "sorted:";
+    for (std::size_t i {0}; i < count; ++i) {
+        std::cout << " " << f[i];
+    } // end for
+    std::cout << std::endl;
+}
+
+void test11 (Fraction<int64_t> const& f)
+{
+    std::uint8_t key [maxKeySize<int64_t>()];
+    std::size_t const n {encode_key(f, key)};
+    Fraction<int64_t> g {0};
+    decode_key(key, key + n, g);
+    std::cout << f << " key:" << std::hex;
+    for (std::size_t i {0}; i < n; ++i) {
+        std::cout << " " << static_cast<unsigned>(key[i]);
+    } // end for
+    std::cout << std::dec << " decoded " << g << std::endl;
+}
+
+void test11 (std::uint8_t const* key, std::size_t n)
+{
+    Fraction<int64_t> g {0};
+    std::size_t const read {decode_key(key, key + n, g)};
+    std::cout << "key:" << std::hex;
+    for (std::size_t i {0}; i < n; ++i) {
+        std::cout << " " << static_cast<unsigned>(key[i]);
+    } // end for
+    std::cout << std::dec;
+    if (read == 0) {
+        std::cout << " rejected" << std::endl;
+    } else {
+        std::cout << " decoded " << g << std::endl;
+    } // end if
+}
+
+void test12 (Fraction<int32_t> const* f, std::size_t count, Fraction<int32_t> const& x)
+{
+    std::uint64_t mask {0};
+    greater_mask(f, count, x, &mask);
+    std::cout << "greater than " << x << ": mask " << std::hex << mask << std::dec;
+    std::pair<Fraction<int32_t>, Fraction<int32_t>> const range {minmax(f, count)};
+    std::cout << ", min " << range.first << " (index " << argmin(f, count) << "), max " << range.second << std::endl;
+}
+
+void test13 (Fraction<int64_t> const& f1, Fraction<int64_t> const& f2)
+{
+    FractionPool<int64_t> pool;
+    std::uint32_t const id1 {pool.intern(f1)};
+    std::uint32_t const id2 {pool.intern(f2)};
+    std::cout << f1 << " id " << id1 << ", " << f2 << " id " << id2 << ", pool size " << pool.size();
+    std::cout << ", same hash " << (std::hash<Fraction<int64_t>> {}(f1) == std::hash<Fraction<int64_t>> {}(f2)) << std::endl;
+}
+
+void test14 (Fraction<int64_t> const& a, Fraction<int64_t> const& b, Fraction<int64_t> const& c)
+{
+    Fraction<int64_t> const f {fused(a)*b + fused(c)*a - b};
+    std::cout << a << " * " << b << " + " << c << " * " << a << " - " << b << " = " << f << std::endl;
+}
+
+void test15 (Fraction<int64_t> const* a, Fraction<int64_t> const* b, std::size_t count)
+{
+    std::cout << "fma(" << a[0] << ", " << b[0] << ", " << a[1] << ") = " << dd::fma(a[0], b[0], a[1]);
+    std::cout << ", fms = " << dd::fms(a[0], b[0], a[1]);
+    std::cout << ", dot = " << dot(a, b, count) << std::endl;
+}
+
+void test16 (std::string const& expression, Fraction<int64_t> const* const* columns, std::size_t rows)
+{
+    FractionProgram<int64_t> program;
+    Fraction<int64_t> out [4] {};
+    if (!program.compile(expression, {"x", "y", "z"})) {
+        std::cout << expression << ": " << program.error() << " =";
+    } else {
+        std::cout << expression << " (" << program.size() << " instructions) =";
+    } // end if
+    program.run(columns, rows, out);
+    for (std::size_t i {0}; i < rows; ++i) {
+        std::cout << " " << out[i];
+    } // end for
+    std::cout << std::endl;
+}
+
+void test17 (Fraction<int64_t> const& f, int n)
+{
+    std::cout << f << "^" << n << " = " << dd::pow(f, n) << ", " << f << "^" << -n << " = " << dd::pow(f, -n) << std::endl;
+}
+
+void test18 (Fraction<int64_t> const& f, int n, Fraction<int64_t> const& eps)
+{
+    std::cout << "root " << n << " of " << f << " (error " << eps << ") = " << dd::nth_root_approx(f, n, eps) << std::endl;
+}
+
+void test19 (std::string const& name, ContinuedFraction cf, int count)
+{
+    Convergents<int64_t> convergents {cf};
+    Fraction<int64_t> f {};
+    std::cout << name << ":";
+    for (int i {0}; (i < count) && convergents.next(f); ++i) {
+        std::cout << " " << f;
+    } // end for
+    std::cout << std::endl;
+}
+
+SeriesTerm harmonicTerm (std::int64_t k)
+{
+    // 1/k
+    return SeriesTerm {1, k, 1, 1};
+}
+
+SeriesTerm exponentialTerm (std::int64_t k)
+{
+    // 1/k! (the ratio to the previous term is 1/k)
+    return SeriesTerm {1, 1, 1, (k == 0) ? 1 : k};
+}
+
+void test20 (std::int64_t terms)
+{
+    std::cout << "H(" << terms << ") = " << binary_splitting(harmonicTerm, 1, terms + 1) << std::endl;
+    std::cout << "e ~ " << binary_splitting(exponentialTerm, 0, terms) << std::endl;
+}
+
+void test21 (std::int64_t const* values, Fraction<int64_t> const* f, std::size_t count)
+{
+    std::vector<std::int64_t> gcds (count);
+    batch_gcd(values, count, gcds.data());
+    std::vector<BigInt> nums (count);
+    BigInt const lcm {common_denominator(f, count, nums.data())};
+    for (std::size_t i {0}; i < count; ++i) {
+        std::cout << "gcd(" << values[i] << ", others) = " << gcds[i] << ", " << f[i] << " = " << nums[i] << "/" << lcm << std::endl;
+    } // end for
+}
+
+void test22 (PrimeSieve const& sieve, std::int64_t terms)
+{
+    FactoredSum<int64_t> sum {sieve};
+    for (std::int64_t k {1}; k <= terms; ++k) {
+        sum.add(Fraction<int64_t> {1, k});
+    } // end for
+    std::cout << "H(" << terms << ") = " << sum.value() << " = " << sum.bigValue() << std::endl;
+}
+
+void test23 (PrimeSieve const& sieve, std::int64_t people)
+{
+    FactoredProduct<int64_t> product {sieve};
+    for (std::int64_t k {0}; k < people; ++k) {
+        product.multiply(Fraction<int64_t> {365 - k, 365});
+    } // end for
+    std::cout << "P(" << people << " distinct birthdays) = " << product.value() << " = " << product.bigValue() << std::endl;
+}
+
+BigInt fibonacci (int n)
+{
+    BigInt a {0}, b {1};
+    for (int i {0}; i < n; ++i) {
+        BigInt const c {a + b};
+        a = b;
+        b = c;
+    } // end for
+    return a;
+}
+
+void test24 (int m, int n, int g)
+{
+    BigInt const fm {fibonacci(m)};
+    BigInt const fn {fibonacci(n)};
+    std::cout << "gcd(F(" << m << "), F(" << n << ")) = F(" << g << "): " << std::boolalpha
+              << (BigInt::gcd(fm, fn) == fibonacci(g)) << " (" << fm.bitLength() << " and " << fn.bitLength() << " bits)" << std::endl;
+}
+
 int main()
 {
     std::cout << "Test 1: Nominal case (positive values)" << std::endl;
@@ -49,6 +319,102 @@ int main()
     Fraction<int32_t> f9 {1,0};
     Fraction<int32_t> f10 {};
     test01(f9,f10);
+    std::cout << std::endl << "Test 6: compact serialization" << std::endl;
+    Fraction<int64_t> const f11 [4] {{-3}, {100,150}, {1,0}, {0,0}};
+    test02(f11, 4);
+    std::cout << std::endl << "Test 7: compressed column" << std::endl;
+    test03(f11, 4);
+    std::cout << std::endl << "Test 8: conversion to floating point" << std::endl;
+    Fraction<int64_t> const f12 [4] {{1,3}, {INT64_MAX,INT64_MAX-1}, {-1,0}, {0,0}};
+    test04(f12, 4);
+    std::cout << std::endl << "Test 9: conversion from floating point" << std::endl;
+    test05(3.14159265358979, 100);
+    test05(3.14159265358979, 1000);
+    test05(-0.1, 1000);
+    std::cout << std::endl << "Test 10: Stern-Brocot searches" << std::endl;
+    test06(Fraction<int32_t> {3,7}, Fraction<int32_t> {4,9});
+    std::cout << std::endl << "Test 11: comparison of large values" << std::endl;
+    test07(Fraction<int64_t> {INT64_MAX,INT64_MAX-1}, Fraction<int64_t> {INT64_MAX-1,INT64_MAX-2});
+    test07(Fraction<int64_t> {-INT64_MAX,3}, Fraction<int64_t> {INT64_MIN});
+    std::cout << std::endl << "Test 12: lazy exact Fractions" << std::endl;
+    test08(LazyFraction<int64_t> {Fraction<int64_t> {2,3}}, LazyFraction<int64_t> {Fraction<int64_t> {5,2}});
+    test08(LazyFraction<int64_t> {Fraction<int64_t> {1,2}}, LazyFraction<int64_t> {Fraction<int64_t> {-1,1}});
+    std::cout << std::endl << "Test 13: comparison with integers and doubles" << std::endl;
+    test09(Fraction<int64_t> {7,2}, 3, 3.5);
+    test09(Fraction<int64_t> {1,3}, 0, 0.333333333333333333);
+    test09(Fraction<int64_t> {INT64_MAX-1,INT64_MAX}, 1, 1e30);
+    std::cout << std::endl << "Test 14: sort" << std::endl;
+    Fraction<int64_t> f13 [6] {{0,0}, {INT64_MAX-1,INT64_MAX}, {-1,3}, {1,0}, {INT64_MAX-2,INT64_MAX-1}, {2}};
+    test10(f13, 6);
+    std::cout << std::endl << "Test 15: order preserving keys" << std::endl;
+    test11(Fraction<int64_t> {-5,3});
+    test11(Fraction<int64_t> {5,3});
+    test11(Fraction<int64_t> {INT64_MAX,1000});
+    test11(Fraction<int64_t> {0,0});
+    std::uint8_t const key1 [3] {0x03, 0x05, 0x00};
+    std::uint8_t const key2 [4] {0x03, 0xF7, 0x05, 0x00};
+    std::uint8_t const key3 [5] {0x03, 0xF8, 0x00, 0xF7, 0x00};
+    test11(key1, 3);
+    test11(key2, 4);
+    test11(key3, 5);
+    std::cout << std::endl << "Test 16: batch comparison and reductions" << std::endl;
+    Fraction<int32_t> const f16 [5] {{1,2}, {0,0}, {-7,3}, {5,4}, {2,3}};
+    test12(f16, 5, Fraction<int32_t> {2,3});
+    std::cout << std::endl << "Test 17: hash and interning" << std::endl;
+    test13(Fraction<int64_t> {1,2}, Fraction<int64_t> {3,6});
+    test13(Fraction<int64_t> {1,2}, Fraction<int64_t> {2,3});
+    std::cout << std::endl << "Test 18: fused expressions" << std::endl;
+    test14(Fraction<int64_t> {1,2}, Fraction<int64_t> {2,3}, Fraction<int64_t> {3,4});
+    test14(Fraction<int64_t> {1099511627777,2147483648}, Fraction<int64_t> {2147483648,1099511627777}, Fraction<int64_t> {0});
+    test14(Fraction<int64_t> {1099511627776}, Fraction<int64_t> {1099511627776}, Fraction<int64_t> {0});
+    std::cout << std::endl << "Test 19: fused multiply-add and dot product" << std::endl;
+    Fraction<int64_t> const f19a [3] {{1,2}, {1,3}, {-5,4}};
+    Fraction<int64_t> const f19b [3] {{2,3}, {3,5}, {4,7}};
+    test15(f19a, f19b, 3);
+    // denominators of 40 bits: their lcm does not fit in 128 bits
+    Fraction<int64_t> const f19c [5] {{1,1099511627791}, {1,1099511627803}, {1,1099511627831}, {1,1099511627873}, {-1,1099511627873}};
+    Fraction<int64_t> const f19d [5] {{1}, {1}, {1}, {1}, {1}};
+    test15(f19c, f19d, 5);
+    std::cout << std::endl << "Test 20: compiled expressions" << std::endl;
+    Fraction<int64_t> const f20x [3] {{1,2}, {-1,3}, {2}};
+    Fraction<int64_t> const f20y [3] {{3}, {3,4}, {1,5}};
+    Fraction<int64_t> const f20z [3] {{5,2}, {1}, {2}};
+    Fraction<int64_t> const* const f20 [3] {f20x, f20y, f20z};
+    test16("(x + 1/3) * y / (z - 2)", f20, 3);
+    test16("-x * (2 + 4) + y", f20, 3);
+    test16("x + * y", f20, 3);
+    std::cout << std::endl << "Test 21: integer powers" << std::endl;
+    test17(Fraction<int64_t> {-2,3}, 5);
+    test17(Fraction<int64_t> {10,7}, 0);
+    test17(Fraction<int64_t> {3,2}, 40);
+    test17(Fraction<int64_t> {0}, 3);
+    std::cout << std::endl << "Test 22: square and nth roots" << std::endl;
+    test18(Fraction<int64_t> {2}, 2, Fraction<int64_t> {1,1000000});
+    test18(Fraction<int64_t> {-27,8}, 3, Fraction<int64_t> {1,100});
+    test18(Fraction<int64_t> {10}, 5, Fraction<int64_t> {1,1000});
+    test18(Fraction<int64_t> {-1}, 2, Fraction<int64_t> {1,10});
+    std::cout << std::endl << "Test 23: continued fractions and Gosper's algorithm" << std::endl;
+    test19("sqrt(2)", ContinuedFraction::sqrt(2), 6);
+    test19("e", ContinuedFraction::e(), 6);
+    test19("sqrt(2) + e", ContinuedFraction::sqrt(2) + ContinuedFraction::e(), 6);
+    test19("355/113 * 2/3", ContinuedFraction::from_fraction(Fraction<int64_t> {355,113}) *
+                            ContinuedFraction::from_fraction(Fraction<int64_t> {2,3}), 6);
+    std::cout << std::endl << "Test 24: binary splitting of series" << std::endl;
+    test20(30);
+    std::cout << std::endl << "Test 25: batch gcd and common denominator" << std::endl;
+    std::int64_t const v1 [4] {6, 10, 15, 7};
+    Fraction<int64_t> const f21 [4] {{1,6}, {-3,4}, {5,9}, {7,10}};
+    test21(v1, f21, 4);
+    std::cout << std::endl << "Test 26: sums with factored denominators" << std::endl;
+    PrimeSieve const sieve {1000};
+    test22(sieve, 20);
+    test22(sieve, 50);
+    std::cout << std::endl << "Test 27: products with factored Fractions" << std::endl;
+    test23(sieve, 5);
+    test23(sieve, 23);
+    std::cout << std::endl << "Test 28: half-GCD of large integers" << std::endl;
+    test24(24000, 18000, 6000);
+    test24(30000, 29999, 1);
 
     return 0;
 }